@@ -0,0 +1,230 @@
+#!/bin/sh
+
+# Reproducible benchmark runner for MIRA
+#
+# Runs a fixed set of assemblies on the minidemo data sets, collects the
+#  per-phase telemetry MIRA writes into
+#    <project>_assembly/<project>_d_info/<project>_info_telemetry.json
+#  and either saves the numbers as baseline (-s) or compares them against
+#  a previously saved baseline.
+#
+# Timings and memory are machine specific, therefore no baseline is
+#  shipped: create one on your machine with the MIRA version you want to
+#  compare against, then run again with the new version.
+#
+#   ./runbench.sh -m /path/to/old/mira -s
+#   ./runbench.sh -m /path/to/new/mira
+#
+# The comparison fails (exit code 1) if the wall time of the whole run or
+#  of a top level phase, or the peak RSS of a data set grew by more than
+#  the tolerance. Phases running less than -f seconds are not compared
+#  (too noisy). Changed event counters (number of skim hits, alignments,
+#  reads added to contigs etc.) are reported, they hint at changed
+#  results, but do not count as regression.
+#
+# Options:
+#  -m binary    mira binary to use (default: mira from PATH)
+#  -d "sets"    data sets to run (default: all)
+#                 sanger_u13 est_tvc solexa_mapping 454_spneu
+#  -w dir       working directory (default: ./benchwork)
+#  -b file      baseline file (default: ./baseline.tsv)
+#  -t percent   tolerance in percent (default: 10)
+#  -f seconds   minimum duration of phases to compare (default: 2)
+#  -n threads   number of threads for MIRA (default: 1, most reproducible)
+#  -s           save results as new baseline, do not compare
+
+ALLSETS="sanger_u13 est_tvc solexa_mapping 454_spneu"
+
+MIRA=mira
+SETS=$ALLSETS
+WORKDIR=`pwd`/benchwork
+BASELINE=`pwd`/baseline.tsv
+TOLERANCE=10
+MINSECONDS=2
+THREADS=1
+SAVEBASELINE=0
+
+SCRIPTDIR=`dirname $0`
+DATADIR=`cd $SCRIPTDIR/../data && pwd`
+
+usage() {
+  sed -n '/^# Options:/,/^$/p' $0 | sed 's/^#//'
+  exit 2
+}
+
+while getopts "m:d:w:b:t:f:n:sh" opt; do
+  case $opt in
+    m) MIRA=$OPTARG ;;
+    d) SETS=$OPTARG ;;
+    w) WORKDIR=$OPTARG ;;
+    b) BASELINE=$OPTARG ;;
+    t) TOLERANCE=$OPTARG ;;
+    f) MINSECONDS=$OPTARG ;;
+    n) THREADS=$OPTARG ;;
+    s) SAVEBASELINE=1 ;;
+    *) usage ;;
+  esac
+done
+
+if ! command -v $MIRA >/dev/null 2>&1 ; then
+  echo "Cannot find mira binary '$MIRA'"
+  exit 2
+fi
+if [ $SAVEBASELINE -eq 0 -a ! -f $BASELINE ] ; then
+  echo "No baseline file $BASELINE, create one first with -s"
+  exit 2
+fi
+
+mkdir -p $WORKDIR || exit 2
+RESULTS=$WORKDIR/results.tsv
+: >$RESULTS
+
+
+# writes the MIRA manifest for a data set, prints project name
+writemanifest() {
+  case $1 in
+    sanger_u13)
+      cat >manifest.conf <<EOF
+project = u13
+job = genome,denovo,accurate
+parameters = -GE:not=$THREADS
+readgroup = u13
+technology = sanger
+data = $DATADIR/fasta_set1/U13small_m.fasta
+EOF
+      echo u13 ;;
+    est_tvc)
+      cat >manifest.conf <<EOF
+project = tvc
+job = est,denovo,accurate
+parameters = -GE:not=$THREADS
+readgroup = tvc
+technology = sanger
+data = $DATADIR/fasta_estset1/tvc_mini.fasta
+EOF
+      echo tvc ;;
+    solexa_mapping)
+      cat >manifest.conf <<EOF
+project = ecoli
+job = genome,mapping,accurate
+parameters = -GE:not=$THREADS
+readgroup = backbone
+is_reference
+data = $DATADIR/solexa_eco_art/ecoli_backbone_in.gbf
+readgroup = solexa
+technology = solexa
+data = $DATADIR/solexa_eco_art/ecoli_in.solexa.fasta
+EOF
+      echo ecoli ;;
+    454_spneu)
+      cat >manifest.conf <<EOF
+project = spneu
+job = genome,denovo,accurate
+parameters = -GE:not=$THREADS
+readgroup = spneu
+technology = 454
+data = fna::$DATADIR/spneu_t4_40k_454/spneu_t4_40k_in.454.fasta
+default_qual = 30
+EOF
+      echo spneu ;;
+    *)
+      return 1 ;;
+  esac
+}
+
+# telemetry json -> "dataset <tab> metric <tab> value" lines
+extracttelemetry() {
+  awk -v ds=$1 '
+    function field(line,key,   s){
+      if(!match(line,"\"" key "\": [^,}]*")) return "";
+      s=substr(line,RSTART,RLENGTH);
+      sub(/^[^:]*: /,"",s);
+      return s;
+    }
+    /^"wall_s":/     {v=$2; sub(/,$/,"",v); print ds "\ttotal/wall_s\t" v}
+    /^"cpu_s":/      {v=$2; sub(/,$/,"",v); print ds "\ttotal/cpu_s\t" v}
+    /^"peak_rss":/   {v=$2; sub(/,$/,"",v); print ds "\ttotal/peak_rss\t" v}
+    /^"counters":/   {
+      n=split($0,a,/[{},]/);
+      for(i=1;i<=n;i++){
+        if(split(a[i],kv,/: /)==2 && kv[2]!=""){
+          k=kv[1]; gsub(/[" ]/,"",k);
+          print ds "\tcount/" k "\t" kv[2];
+        }
+      }
+    }
+    /^\{"phase":/    {
+      if(field($0,"depth")!="0") next;
+      p=field($0,"phase"); gsub(/"/,"",p);
+      print ds "\tphase/" p "/wall_s\t" field($0,"wall_s");
+      print ds "\tphase/" p "/peak_rss\t" field($0,"peak_rss");
+    }
+  ' $2
+}
+
+
+FAILED=0
+for ds in $SETS ; do
+  echo "Running $ds ..."
+  rm -rf $WORKDIR/$ds
+  mkdir -p $WORKDIR/$ds
+  cd $WORKDIR/$ds
+  proj=`writemanifest $ds`
+  if [ $? -ne 0 ] ; then
+    echo "Unknown data set $ds (known: $ALLSETS)"
+    exit 2
+  fi
+  $MIRA manifest.conf >log_assembly.txt 2>&1
+  rc=$?
+  tjson=${proj}_assembly/${proj}_d_info/${proj}_info_telemetry.json
+  if [ $rc -ne 0 -o ! -f $tjson ] ; then
+    echo "MIRA failed on $ds (exit code $rc), see $WORKDIR/$ds/log_assembly.txt"
+    FAILED=1
+    continue
+  fi
+  extracttelemetry $ds $tjson >>$RESULTS
+  awk -F'\t' -v ds=$ds '$1==ds && $2 ~ /^total\// {print "  " $2 "\t" $3}' $RESULTS
+done
+cd $WORKDIR
+
+if [ $SAVEBASELINE -eq 1 ] ; then
+  if [ $FAILED -ne 0 ] ; then
+    echo "Not all data sets ran through, baseline not saved."
+    exit 1
+  fi
+  cp $RESULTS $BASELINE
+  echo "Baseline saved to $BASELINE"
+  exit 0
+fi
+
+echo
+echo "Comparing against $BASELINE (tolerance $TOLERANCE%, phases >= ${MINSECONDS}s)"
+awk -F'\t' -v tol=$TOLERANCE -v mins=$MINSECONDS '
+  FNR==NR {base[$1 "\t" $2]=$3; next}
+  {
+    key=$1 "\t" $2;
+    if(!(key in base)) next;
+    b=base[key]+0; c=$3+0;
+    if($2 ~ /^count\//){
+      if(b!=c) printf("  changed    %-16s %-32s %14s -> %s\n",$1,$2,base[key],$3);
+      next;
+    }
+    if($2 ~ /wall_s$|cpu_s$/ && b<mins && c<mins) next;
+    if(b>0) pct=(c-b)*100/b; else pct=0;
+    status="ok";
+    if(c>b*(1+tol/100)) {status="REGRESSION"; bad=1}
+    else if(c<b*(1-tol/100)) status="improved";
+    printf("  %-10s %-16s %-32s %14s -> %-14s (%+.1f%%)\n",status,$1,$2,base[key],$3,pct);
+  }
+  END {exit bad}
+' $BASELINE $RESULTS
+if [ $? -ne 0 ] ; then
+  FAILED=1
+fi
+
+if [ $FAILED -ne 0 ] ; then
+  echo "Benchmark FAILED"
+  exit 1
+fi
+echo "Benchmark passed"
+exit 0
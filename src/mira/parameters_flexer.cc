@@ -334,8 +334,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 621
-#define YY_END_OF_BUFFER 622
+#define YY_NUM_RULES 625
+#define YY_END_OF_BUFFER 626
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -343,7 +343,7 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[6278] =
+static yyconst flex_int16_t yy_accept[6326] =
     {   0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -351,690 +351,696 @@ static yyconst flex_int16_t yy_accept[6278] =
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  622,  621,  618,  616,  621,  620,  620,  612,
-      612,  613,  615,  614,  610,  610,  610,  610,  610,  610,
-      621,  526,  525,  525,  526,  526,  526,  523,  526,  526,
-      526,  526,  523,  526,  526,  526,  526,  526,  526,  526,
-
-      526,  526,  526,  526,  526,  526,  526,  526,  526,  526,
-      526,  526,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,   24,  620,  620,   23,   23,
-       21,   21,   21,   21,   21,   21,   21,   21,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  616,  621,  612,  612,  610,
-      610,  610,  610,  610,  610,  621,  223,  222,  223,  223,
-      223,  223,  223,  223,  223,  223,  222,  223,  223,  221,
-      223,  221,  223,  223,  223,  220,  220,  223,  220,  213,
-      212,  213,  213,  213,  213,  213,  213,  213,  213,  209,
-
-      213,  209,  213,  213,  213,  213,  213,  213,  213,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  393,  620,  620,  384,
-      386,  388,  392,  392,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  478,  620,  620,  481,  481,
-      478,  479,  479,  479,  479,  479,  479,  479,  479,  479,
-
-      402,  620,  620,  401,  401,  399,  399,  399,  399,  399,
-      399,  399,  399,  399,  621,  618,  617,  616,  621,  620,
-      620,  612,  612,  613,  615,  614,  610,  610,  610,  610,
-      610,  610,  621,  537,  612,  610,  610,  610,  610,  610,
-        0,  612,  619,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  626,  625,  622,  620,  625,  624,  624,  616,
+      616,  617,  619,  618,  614,  614,  614,  614,  614,  614,
+      625,  530,  529,  529,  530,  530,  530,  527,  530,  530,
+      530,  530,  527,  530,  530,  530,  530,  530,  530,  530,
+
+      530,  530,  530,  530,  530,  530,  530,  530,  530,  530,
+      530,  530,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,   26,  624,  624,   25,   25,
+       23,   23,   23,   23,   23,   23,   23,   23,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  620,  625,  616,  616,  614,
+      614,  614,  614,  614,  614,  625,  227,  226,  227,  227,
+      227,  227,  227,  227,  227,  227,  226,  227,  227,  225,
+      227,  225,  227,  227,  227,  224,  224,  227,  224,  217,
+      216,  217,  217,  217,  217,  217,  217,  217,  217,  213,
+
+      217,  213,  217,  217,  217,  217,  217,  217,  217,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  397,  624,  624,  388,
+      390,  392,  396,  396,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  482,  624,  624,  485,  485,
+      482,  483,  483,  483,  483,  483,  483,  483,  483,  483,
+
+      406,  624,  624,  405,  405,  403,  403,  403,  403,  403,
+      403,  403,  403,  403,  625,  622,  621,  620,  625,  624,
+      624,  616,  616,  617,  619,  618,  614,  614,  614,  614,
+      614,  614,  625,  541,  616,  614,  614,  614,  614,  614,
+        0,  616,  623,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  612,  612,  610,  610,  610,  610,
-      610,  610,  610,    0,    0,    0,    0,    0,    0,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,   12,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-       26,  610,  610,   23,    0,   23,   23,   21,   21,   21,
-       21,   21,   21,   21,   21,   21,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,   70,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  610,  219,  610,  214,  610,
-      610,    0,  209,    0,    0,  209,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  293,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  303,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  371,  610,  369,  610,  610,  392,    0,
-      392,  382,  392,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  241,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  395,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  408,  610,  610,
-      433,  610,  610,  610,  610,  610,  610,  610,  447,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  481,    0,  481,  481,  479,  479,
-      479,  479,  479,  479,  479,  475,  479,  479,  401,    0,
-      401,  401,  399,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,    0,  617,    0,  612,  619,  617,    0,    0,
+        0,    0,    0,    0,  616,  616,  614,  614,  614,  614,
+      614,  614,  614,    0,    0,    0,    0,    0,    0,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,   14,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+       28,  614,  614,   25,    0,   25,   25,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,   72,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  614,  223,  614,  218,  614,
+      614,    0,  213,    0,    0,  213,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  297,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  307,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  375,  614,  373,  614,  614,  396,    0,
+      396,  386,  396,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  245,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  399,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  412,  614,  614,
+      437,  614,  614,  614,  614,  614,  614,  614,  451,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  485,    0,  485,  485,  483,  483,
+      483,  483,  483,  483,  483,  479,  483,  483,  405,    0,
+      405,  405,  403,  403,  403,  403,  403,  403,  403,  403,
+      403,  403,    0,  621,    0,  616,  623,  621,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  612,
-      612,  610,  610,  610,  610,  610,  610,  610,    0,    0,
-        0,    0,    0,    0,  612,  610,  610,  610,  610,  610,
-      610,    0,    0,  563,  552,  545,  565,    0,  568,  554,
-      556,    0,  550,  539,    0,  561,    0,  541,  570,    0,
-
-      574,  548,    0,  576,  543,  558,    0,    0,    0,    0,
-        0,    0,    0,  611,  612,  610,  610,  610,  610,  610,
-      610,    0,    0,    0,    0,    0,    0,    0,  524,  509,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  502,  524,  524,  524,  524,  524,  524,
-        8,  610,  610,  610,  610,   10,  610,  610,  610,  610,
-      610,    6,    2,  610,  610,  610,  610,  610,   36,   44,
-      610,  610,   28,   30,  610,  610,  610,   42,  610,  610,
-      610,   18,   22,   23,   21,   21,   21,   21,   21,   20,
-
-       21,   21,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,   78,  610,  610,  610,  610,  610,
-      610,  610,  610,  119,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  144,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  190,  182,  200,
-      198,  186,  184,  194,  188,  192,  164,  160,  168,  166,
-      154,  162,  158,  156,  610,  610,  610,  152,  610,  610,
-      610,  610,  610,  610,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  610,
-
-      215,  610,  218,  211,  210,  610,  610,  610,  610,  610,
-      610,  610,  610,  485,  610,  610,  610,  610,  610,  285,
-      610,  610,  291,  610,  610,  610,  610,  299,  610,  610,
-      610,  610,  331,  610,  610,  610,  301,  610,  610,  610,
-      610,  610,  610,  610,  323,  610,  295,  319,  317,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  351,
-      610,  610,  357,  610,  610,  610,  610,  343,  610,  339,
-      337,  610,  610,  610,  610,  610,  363,  610,  610,  377,
-      610,  610,  610,  610,  373,  610,  610,  391,  392,  390,
-      390,  390,  390,  390,  390,  390,  385,  390,  390,  245,
-
-      610,  269,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  229,  610,  233,  610,  237,  610,  610,  610,
-      235,  610,  610,  610,  610,  610,  610,  610,  610,  257,
-      610,  610,  610,  610,  610,  610,  610,  273,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  445,  610,  610,  610,  610,  416,  610,  610,  443,
-      610,  410,  610,  610,  610,  226,  225,  454,  455,  456,
-      610,  610,  610,  610,  453,  610,  610,  474,  610,  472,
-      610,  610,  610,  610,  610,  462,  610,  610,  480,  481,
-      479,  479,  479,  479,  479,  479,  479,  479,  400,  401,
-
-      399,  399,  399,  399,  399,  399,  399,  399,  399,    0,
-        0,  563,  552,  545,  565,    0,  568,  554,  556,    0,
-      550,  539,    0,  561,    0,  541,  570,    0,  574,  548,
-        0,  576,  543,  558,    0,    0,    0,    0,    0,    0,
-        0,  611,  612,  610,  610,  610,  610,  610,  610,    0,
-        0,    0,    0,    0,    0,    0,  530,  528,  610,  610,
-      610,  610,  610,    0,    0,    0,    0,    0,    0,  567,
-        0,    0,    0,    0,    0,    0,    0,  573,  547,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  616,
+      616,  614,  614,  614,  614,  614,  614,  614,    0,    0,
+        0,    0,    0,    0,  616,  614,  614,  614,  614,  614,
+      614,    0,    0,  567,  556,  549,  569,    0,  572,  558,
+      560,    0,  554,  543,    0,  565,    0,  545,  574,    0,
+
+      578,  552,    0,  580,  547,  562,    0,    0,    0,    0,
+        0,    0,    0,  615,  616,  614,  614,  614,  614,  614,
+      614,    0,    0,    0,    0,    0,    0,    0,  528,  513,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  506,  528,  528,  528,  528,  528,  528,
+        8,  614,  614,  614,  614,   12,  614,  614,  614,  614,
+      614,    6,    2,  614,  614,  614,  614,  614,   38,   46,
+      614,  614,   30,   32,  614,  614,  614,   44,  614,  614,
+      614,   20,   24,   25,   23,   23,   23,   23,   23,   22,
+
+       23,   23,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,   80,  614,  614,  614,  614,  614,
+      614,  614,  614,  121,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  146,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  192,  184,  202,
+      200,  188,  186,  196,  190,  194,  166,  162,  170,  168,
+      156,  164,  160,  158,  614,  614,  614,  154,  614,  614,
+      614,  614,  614,  614,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  614,
+
+      219,  614,  222,  215,  214,  614,  614,  614,  614,  614,
+      614,  614,  614,  489,  614,  614,  614,  614,  614,  289,
+      614,  614,  295,  614,  614,  614,  614,  303,  614,  614,
+      614,  614,  335,  614,  614,  614,  305,  614,  614,  614,
+      614,  614,  614,  614,  327,  614,  299,  323,  321,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  355,
+      614,  614,  361,  614,  614,  614,  614,  347,  614,  343,
+      341,  614,  614,  614,  614,  614,  367,  614,  614,  381,
+      614,  614,  614,  614,  377,  614,  614,  395,  396,  394,
+      394,  394,  394,  394,  394,  394,  389,  394,  394,  249,
+
+      614,  273,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  233,  614,  237,  614,  241,  614,  614,  614,
+      239,  614,  614,  614,  614,  614,  614,  614,  614,  261,
+      614,  614,  614,  614,  614,  614,  614,  277,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  449,  614,  614,  614,  614,  420,  614,  614,  447,
+      614,  414,  614,  614,  614,  230,  229,  458,  459,  460,
+      614,  614,  614,  614,  457,  614,  614,  478,  614,  476,
+      614,  614,  614,  614,  614,  466,  614,  614,  484,  485,
+      483,  483,  483,  483,  483,  483,  483,  483,  404,  405,
+
+      403,  403,  403,  403,  403,  403,  403,  403,  403,    0,
+        0,  567,  556,  549,  569,    0,  572,  558,  560,    0,
+      554,  543,    0,  565,    0,  545,  574,    0,  578,  552,
+        0,  580,  547,  562,    0,    0,    0,    0,    0,    0,
+        0,  615,  616,  614,  614,  614,  614,  614,  614,    0,
+        0,    0,    0,    0,    0,    0,  534,  532,  614,  614,
+      614,  614,  614,    0,    0,    0,    0,    0,    0,  571,
+        0,    0,    0,    0,    0,    0,    0,  577,  551,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  610,  610,  610,  610,  610,  610,  610,    0,    0,
-
-        0,    0,    0,    0,    0,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  520,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  610,  610,  610,
-       16,   14,  610,  610,    4,  610,  610,  610,   40,  610,
-      610,  610,   32,  610,  610,  610,  610,  610,  610,   21,
-       21,   19,   19,   21,   21,   21,   21,   21,  610,  610,
-      610,  610,   64,   99,  136,  142,  610,  610,  610,  107,
-      610,  610,  610,  610,   84,   89,  610,  610,  610,  610,
-       82,   80,  610,  610,  610,  610,  610,  610,  610,   86,
-
-      610,   91,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,   56,
-      610,  610,   66,   68,  610,  610,  610,  610,   88,   93,
-      610,  201,  610,  610,  176,  174,  180,  178,  172,  196,
-      610,  610,  150,  610,  610,  610,  203,  610,  610,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  610,  216,  610,  610,  610,  610,
-      610,  610,  610,  610,  483,  610,  610,  289,  610,  287,
-      283,  610,  610,  311,  610,  610,  610,  325,  335,  333,
-      327,  329,  610,  610,  610,  610,  610,  309,  610,  307,
-
-      305,  315,  610,  610,  610,  610,  610,  610,  610,  345,
-      355,  353,  347,  349,  610,  610,  610,  361,  610,  610,
-      610,  610,  359,  610,  610,  365,  367,  610,  375,  610,
-      610,  610,  610,  381,  610,  390,  390,  390,  390,  390,
-      390,  390,  389,  390,  390,  610,  610,  610,  610,  610,
-      610,  610,  610,  271,  610,  610,  610,  610,  239,  610,
-      610,  231,  610,  610,  610,  610,  610,  610,  610,  263,
-      261,  259,  610,  610,  610,  610,  610,  279,  610,  610,
-      281,  610,  275,  610,  610,  610,  430,  610,  413,  610,
-      610,  406,  424,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  418,  610,  610,  610,  432,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  464,
-      610,  470,  610,  460,  610,  468,  479,  479,  479,  479,
-      479,  479,  479,  476,  477,  399,  399,  399,  399,  399,
-      399,  399,  396,  399,  397,    0,    0,    0,    0,    0,
-        0,  567,    0,    0,    0,    0,    0,    0,    0,  573,
-      547,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  610,  610,  610,  610,  610,  610,  610,
-        0,    0,    0,    0,    0,    0,    0,  610,  610,  610,
-      610,  610,  534,    0,    0,    0,    0,    0,    0,    0,
-
-      555,    0,    0,    0,    0,  569,    0,    0,    0,    0,
-      557,    0,  595,    0,    0,    0,  527,    0,    0,    0,
-        0,    0,  610,  610,  610,  610,  610,  610,  610,    0,
-        0,    0,    0,    0,    0,    0,    0,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  522,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  498,  503,  504,  505,  524,  524,  524,  524,  524,
-      524,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,   38,  610,  610,  610,  610,   21,   21,
-       21,   21,   21,   21,   21,  610,  132,  134,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  109,  113,
-      610,  111,  610,  610,  610,  610,  610,  610,  610,  610,
-       72,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  124,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  205,  610,  170,  610,  610,  610,  610,
-      146,  148,  207,  610,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      217,  610,  495,  610,  497,  487,  491,  489,  493,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      321,  610,  313,  610,  610,  610,  610,  610,  610,  610,
-      341,  610,  610,  610,  610,  379,  610,  610,  610,  610,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  247,
-      251,  249,  610,  610,  610,  610,  610,  610,  265,  610,
-      610,  610,  610,  610,  610,  610,  243,  610,  610,  610,
-      267,  610,  253,  610,  610,  610,  610,  610,  610,  610,
-      277,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  420,  610,  610,
-      411,  610,  610,  610,  439,  610,  610,  610,  610,  610,
-
-      610,  610,  449,  610,  451,  610,  457,  610,  610,  466,
-      610,  479,  479,  479,  479,  479,  479,  479,  399,  399,
-      399,  399,  399,  399,  399,  399,    0,    0,    0,    0,
-        0,    0,    0,  555,    0,    0,    0,    0,  569,    0,
-        0,    0,    0,  557,    0,  595,    0,    0,    0,  527,
-        0,    0,    0,    0,    0,  610,  610,  610,  610,  610,
-      610,  610,    0,    0,    0,    0,    0,    0,    0,    0,
-      610,  610,  610,  610,  536,    0,  562,    0,    0,    0,
+        0,  614,  614,  614,  614,  614,  614,  614,    0,    0,
+
+        0,    0,    0,    0,    0,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  524,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  614,  614,  614,
+       18,   16,  614,  614,    4,  614,  614,  614,   42,  614,
+      614,  614,   34,  614,  614,  614,  614,  614,  614,   23,
+       23,   21,   21,   23,   23,   23,   23,   23,  614,  614,
+      614,  614,   66,  101,  138,  144,  614,  614,  614,  109,
+      614,  614,  614,  614,   86,   91,  614,  614,  614,  614,
+       84,   82,  614,  614,  614,  614,  614,  614,  614,   88,
+
+      614,   93,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,   58,
+      614,  614,   68,   70,  614,  614,  614,  614,   90,   95,
+      614,  205,  614,  614,  178,  176,  182,  180,  174,  198,
+      614,  614,  152,  614,  614,  614,  207,  614,  614,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  614,  220,  614,  614,  614,  614,
+      614,  614,  614,  614,  487,  614,  614,  293,  614,  291,
+      287,  614,  614,  315,  614,  614,  614,  329,  339,  337,
+      331,  333,  614,  614,  614,  614,  614,  313,  614,  311,
+
+      309,  319,  614,  614,  614,  614,  614,  614,  614,  349,
+      359,  357,  351,  353,  614,  614,  614,  365,  614,  614,
+      614,  614,  363,  614,  614,  369,  371,  614,  379,  614,
+      614,  614,  614,  385,  614,  394,  394,  394,  394,  394,
+      394,  394,  393,  394,  394,  614,  614,  614,  614,  614,
+      614,  614,  614,  275,  614,  614,  614,  614,  243,  614,
+      614,  235,  614,  614,  614,  614,  614,  614,  614,  267,
+      265,  263,  614,  614,  614,  614,  614,  283,  614,  614,
+      285,  614,  279,  614,  614,  614,  434,  614,  417,  614,
+      614,  410,  428,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  422,  614,  614,  614,  436,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  468,
+      614,  474,  614,  464,  614,  472,  483,  483,  483,  483,
+      483,  483,  483,  480,  481,  403,  403,  403,  403,  403,
+      403,  403,  400,  403,  401,    0,    0,    0,    0,    0,
+        0,  571,    0,    0,    0,    0,    0,    0,    0,  577,
+      551,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  614,  614,  614,  614,  614,  614,  614,
+        0,    0,    0,    0,    0,    0,    0,  614,  614,  614,
+      614,  614,  538,    0,    0,    0,    0,    0,    0,    0,
+
+      559,    0,    0,    0,    0,  573,    0,    0,    0,    0,
+      561,    0,  599,    0,    0,    0,  531,    0,    0,    0,
+        0,    0,  614,  614,  614,  614,  614,  614,  614,    0,
+        0,    0,    0,    0,    0,    0,    0,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  526,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  502,  507,  508,  509,  528,  528,  528,  528,  528,
+      528,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,   40,  614,  614,  614,  614,   23,   23,
+       23,   23,   23,   23,   23,  614,  134,  136,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  111,  115,
+      614,  113,  614,  614,  614,  614,  614,  614,  614,  614,
+       74,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  126,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  209,  614,  172,  614,  614,  614,  614,
+      148,  150,  211,  614,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      221,  614,  499,  614,  501,  491,  495,  493,  497,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      325,  614,  317,  614,  614,  614,  614,  614,  614,  614,
+      345,  614,  614,  614,  614,  383,  614,  614,  614,  614,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  251,
+      255,  253,  614,  614,  614,  614,  614,  614,  269,  614,
+      614,  614,  614,  614,  614,  614,  247,  614,  614,  614,
+      271,  614,  257,  614,  614,  614,  614,  614,  614,  614,
+      281,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  424,  614,  614,
+      415,  614,  614,  614,  443,  614,  614,  614,  614,  614,
+
+      614,  614,  453,  614,  455,  614,  461,  614,  614,  470,
+      614,  483,  483,  483,  483,  483,  483,  483,  403,  403,
+      403,  403,  403,  403,  403,  403,    0,    0,    0,    0,
+        0,    0,    0,  559,    0,    0,    0,    0,  573,    0,
+        0,    0,    0,  561,    0,  599,    0,    0,    0,  531,
+        0,    0,    0,    0,    0,  614,  614,  614,  614,  614,
+      614,  614,    0,    0,    0,    0,    0,    0,    0,    0,
+      614,  614,  614,  614,  540,    0,  566,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  610,
-
-      610,  610,  610,  610,  610,  610,  610,    0,    0,    0,
-        0,    0,    0,    0,    0,  524,  524,  524,  511,  524,
-      524,  524,  524,  524,  524,  524,  524,  508,  521,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  506,
-      501,  510,  524,  499,  524,  524,  524,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,   33,  610,
-      610,  610,  610,   21,   21,   21,   21,   21,   21,   21,
-       21,  610,  610,  610,  610,   60,   62,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  115,  610,
-      610,  140,  610,  610,  610,  610,  610,   76,   74,  610,
-
-      610,   97,  610,  610,  610,   50,  610,  610,  610,  610,
-      128,  126,  123,  130,  610,  117,  610,  127,  125,  122,
-      129,  610,  610,  610,   58,  610,  610,  610,  610,  610,
-      610,  138,  610,  610,  610,  610,  610,  610,  610,  610,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  390,  390,  390,  390,  390,  390,  390,  390,  387,
-      390,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  255,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      404,  610,  610,  610,  610,  458,  610,  610,  610,  479,
-      479,  479,  479,  479,  479,  479,  479,  399,  399,  399,
-      399,  399,  399,  399,  399,  398,    0,  562,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  614,
+
+      614,  614,  614,  614,  614,  614,  614,    0,    0,    0,
+        0,    0,    0,    0,    0,  528,  528,  528,  515,  528,
+      528,  528,  528,  528,  528,  528,  528,  512,  525,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  510,
+      505,  514,  528,  503,  528,  528,  528,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,   35,  614,
+      614,  614,  614,   23,   23,   23,   23,   23,   23,   23,
+       23,  614,  614,  614,  614,   62,   64,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  117,  614,
+      614,  142,  614,  614,  614,  614,  614,   78,   76,  614,
+
+      614,   99,  614,  614,  614,   52,  614,  614,  614,  614,
+      130,  128,  125,  132,  614,  119,  614,  129,  127,  124,
+      131,  614,  614,  614,   60,  614,  614,  614,  614,  614,
+      614,  140,  614,  614,  614,  614,  614,  614,  614,  614,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  394,  394,  394,  394,  394,  394,  394,  394,  391,
+      394,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  259,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      408,  614,  614,  614,  614,  462,  614,  614,  614,  483,
+      483,  483,  483,  483,  483,  483,  483,  403,  403,  403,
+      403,  403,  403,  403,  403,  402,    0,  566,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      610,  610,  610,  610,  610,  610,  610,  610,    0,    0,
-        0,    0,    0,    0,    0,    0,  531,  610,  610,  529,
-      535,    0,    0,    0,  564,    0,    0,    0,    0,    0,
-        0,    0,    0,  546,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  610,  610,  610,  610,  610,
-      610,  610,  610,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  524,  524,  524,  524,  524,  524,  524,  518,
-      514,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  507,  524,  524,  519,  515,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,   21,   21,   21,   21,   21,
-       21,   21,   21,  610,  610,  610,  610,  610,  610,  103,
-      610,  101,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,   54,   52,   48,   46,  610,  121,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  297,  296,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  426,  428,  610,  610,  610,  610,  610,  610,  437,
-      435,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      441,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  479,  479,  479,  479,  479,
-      479,  479,  479,  399,  399,  399,  399,  399,  399,  399,
-      399,    0,    0,    0,  564,    0,    0,    0,    0,    0,
-        0,    0,    0,  546,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  610,  610,  610,  610,  610,
-      610,  610,  610,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  532,  533,    0,    0,    0,    0,    0,    0,
-      538,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  597,    0,  610,
-      610,  610,  610,  610,  610,  610,  610,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  524,  524,  524,  524,
-      524,  516,  512,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  500,  517,  513,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,   21,   21,   21,   21,   21,   21,
-       21,   21,  610,  610,  610,  610,  610,  610,  105,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  394,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  479,  479,  479,  479,  479,
-      479,  479,  479,  399,  399,  399,  399,  399,  399,  399,
-      399,    0,    0,    0,    0,    0,    0,  538,    0,    0,
+      614,  614,  614,  614,  614,  614,  614,  614,    0,    0,
+        0,    0,    0,    0,    0,    0,  535,  614,  614,  533,
+      539,    0,    0,    0,  568,    0,    0,    0,    0,    0,
+        0,    0,    0,  550,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  614,  614,  614,  614,  614,
+      614,  614,  614,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  528,  528,  528,  528,  528,  528,  528,  522,
+      518,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  511,  528,  528,  523,  519,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,   23,   23,   23,   23,   23,
+       23,   23,   23,  614,  614,  614,  614,  614,  614,  105,
+      614,  103,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,   56,   54,   50,   48,  614,  123,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  301,  300,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  430,  432,  614,  614,  614,  614,  614,  614,  441,
+      439,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      445,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  483,  483,  483,  483,  483,
+      483,  483,  483,  403,  403,  403,  403,  403,  403,  403,
+      403,    0,    0,    0,  568,    0,    0,    0,    0,    0,
+        0,    0,    0,  550,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  614,  614,  614,  614,  614,
+      614,  614,  614,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  536,  537,    0,    0,    0,    0,    0,    0,
+      542,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  601,    0,  614,
+      614,  614,  614,  614,  614,  614,  614,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,  528,  528,  528,  528,
+      528,  520,  516,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  504,  521,  517,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,   23,   23,   23,   23,   23,   23,
+       23,   23,  614,  614,  614,  614,  614,  614,  107,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  398,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  483,  483,  483,  483,  483,
+      483,  483,  483,  403,  403,  403,  403,  403,  403,  403,
+      403,    0,    0,    0,    0,    0,    0,  542,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  597,    0,  610,  610,  610,  610,
-      610,  610,  610,  610,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  551,  544,    0,    0,  549,  560,
+        0,    0,    0,    0,  601,    0,  614,  614,  614,  614,
+      614,  614,  614,  614,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  555,  548,    0,    0,  553,  564,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,  610,  610,  610,  610,  610,
-      610,  610,  610,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,   21,   21,   21,   21,   21,
-       21,   21,   21,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,   95,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  374,  610,  610,  610,
-      610,  368,  610,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  459,  610,  610,  479,  479,  479,  479,
-      479,  479,  479,  479,  399,  399,  399,  399,  399,  399,
-      399,  399,    0,  551,  544,    0,    0,  549,  560,    0,
+        0,    0,    0,    0,    0,  614,  614,  614,  614,  614,
+      614,  614,  614,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,   23,   23,   23,   23,   23,
+       23,   23,   23,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,   97,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  378,  614,  614,  614,
+      614,  372,  614,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  463,  614,  614,  483,  483,  483,  483,
+      483,  483,  483,  483,  403,  403,  403,  403,  403,  403,
+      403,  403,    0,  555,  548,    0,    0,  553,  564,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  610,  610,  610,  610,  610,  610,
-      610,  610,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  609,    0,  566,    0,  540,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,  607,    0,
-        0,  610,  610,  610,  610,  610,  610,  610,  610,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  610,  610,  610,  610,
-      610,  610,  610,   11,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,   21,   21,   21,   21,   21,   21,   21,
-       21,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  248,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  479,  479,
-      479,  479,  479,  479,  479,  479,  399,  399,  399,  399,
-      399,  399,  399,  399,  609,    0,  566,    0,  540,    0,
+        0,    0,    0,    0,  614,  614,  614,  614,  614,  614,
+      614,  614,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  613,    0,  570,    0,  544,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,  611,    0,
+        0,  614,  614,  614,  614,  614,  614,  614,  614,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  614,  614,  614,  614,
+      614,  614,  614,   13,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,   23,   23,   23,   23,   23,   23,   23,
+       23,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  252,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  483,  483,
+      483,  483,  483,  483,  483,  483,  403,  403,  403,  403,
+      403,  403,  403,  403,  613,    0,  570,    0,  544,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  607,    0,    0,  610,  610,  610,  610,  610,  610,
-      610,  610,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,  571,    0,  575,    0,    0,    0,  601,
-      600,    0,    0,  606,    0,    0,    0,    0,  610,  610,
-      610,  610,  610,  610,  610,  610,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,   21,
-       21,   21,   21,   21,   21,   21,   21,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  106,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  370,  610,  610,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  254,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  422,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  431,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  479,  479,  479,  479,
-      479,  479,  479,  479,  399,  399,  399,  399,  399,  399,
-      399,  399,    0,    0,  571,    0,  575,    0,    0,    0,
-      601,  600,    0,    0,  606,    0,    0,    0,    0,  610,
-      610,  610,  610,  610,  610,  610,  610,    0,    0,    0,
+        0,  611,    0,    0,  614,  614,  614,  614,  614,  614,
+      614,  614,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,  575,    0,  579,    0,    0,    0,  605,
+      604,    0,    0,  610,    0,    0,    0,    0,  614,  614,
+      614,  614,  614,  614,  614,  614,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,   23,
+       23,   23,   23,   23,   23,   23,   23,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  108,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  374,  614,  614,  394,  394,  394,  394,  394,
+
+      394,  394,  394,  394,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  258,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  426,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  435,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  483,  483,  483,  483,
+      483,  483,  483,  483,  403,  403,  403,  403,  403,  403,
+      403,  403,    0,    0,  575,    0,  579,    0,    0,    0,
+      605,  604,    0,    0,  610,    0,    0,    0,    0,  614,
+      614,  614,  614,  614,  614,  614,  614,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  605,  606,  608,    0,    0,  598,
-      579,  610,  610,  610,  610,  610,  610,  610,  610,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,   21,   21,   21,   21,   21,   21,   21,   21,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-       71,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,   69,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  610,  610,  610,
-      610,  610,  610,  250,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  407,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  446,  448,  610,  610,
-      610,  610,  610,  610,  610,  610,  479,  479,  479,  479,
-      479,  479,  479,  479,  399,  399,  399,  399,  399,  399,
-      399,  399,    0,    0,    0,    0,    0,    0,    0,    0,
-      605,  606,  608,    0,    0,  598,  579,  610,  610,  610,
-      610,  610,  610,  610,  610,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  572,    0,    0,    0,
-        0,    0,    0,  610,  610,  610,  610,  610,  610,  610,
-      583,  588,    0,    0,    0,    0,    0,    0,    0,    0,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,   21,   21,   21,   21,   21,   21,   21,
-       21,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,   49,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  364,  366,  610,  610,  610,  610,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  232,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  438,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  479,  479,  479,  479,  479,  479,  479,
-      479,  399,  399,  399,  399,  399,  399,  399,  399,    0,
-        0,  572,    0,    0,    0,    0,    0,    0,  610,  610,
-      610,  610,  610,  610,  610,  583,  588,    0,    0,    0,
+        0,    0,    0,    0,  609,  610,  612,    0,    0,  602,
+      583,  614,  614,  614,  614,  614,  614,  614,  614,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,   23,   23,   23,   23,   23,   23,   23,   23,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+       73,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,   71,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  394,  394,
+
+      394,  394,  394,  394,  394,  394,  394,  614,  614,  614,
+      614,  614,  614,  254,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  411,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  450,  452,  614,  614,
+      614,  614,  614,  614,  614,  614,  483,  483,  483,  483,
+      483,  483,  483,  483,  403,  403,  403,  403,  403,  403,
+      403,  403,    0,    0,    0,    0,    0,    0,    0,    0,
+      609,  610,  612,    0,    0,  602,  583,  614,  614,  614,
+      614,  614,  614,  614,  614,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,  576,    0,    0,    0,
+        0,    0,    0,  614,  614,  614,  614,  614,  614,  614,
+      587,  592,    0,    0,    0,    0,    0,    0,    0,    0,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,   23,   23,   23,   23,   23,   23,   23,
+       23,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,   51,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  368,  370,  614,  614,  614,  614,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  236,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  442,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  483,  483,  483,  483,  483,  483,  483,
+      483,  403,  403,  403,  403,  403,  403,  403,  403,    0,
+        0,  576,    0,    0,    0,    0,    0,    0,  614,  614,
+      614,  614,  614,  614,  614,  587,  592,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  610,  610,  610,  610,  610,  610,  585,
-
-        0,    0,    0,    0,    0,    0,    0,  592,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,   25,
-      610,   21,   21,   21,   21,   21,   21,   21,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  139,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  143,  137,  610,  610,  610,  610,  610,
-      610,  610,  610,  151,  610,  610,  610,  610,  227,  227,
-
-      227,  227,  227,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  610,  610,  610,  610,  610,  484,  610,
-      610,  610,  610,  610,  610,  610,  298,  324,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  344,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  390,  390,  390,  390,  390,  390,  390,
-      390,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  234,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  409,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  479,  479,  479,  479,  479,
-      479,  479,  399,  399,  399,  399,  399,  399,  399,    0,
-        0,    0,    0,    0,    0,    0,    0,  610,  610,  610,
-      610,  610,  610,  585,    0,    0,    0,    0,    0,    0,
-        0,  592,  553,  559,    0,    0,    0,    0,  604,    0,
-      596,  577,  580,  610,  610,  578,  584,    0,    0,    0,
-        0,    0,    0,  594,  524,  524,  524,  524,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  610,    9,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,   21,   21,   21,   21,   21,   21,
-      610,  610,  610,  610,  610,  610,  610,  610,   98,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,   77,   75,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  227,  227,  227,  227,  227,  227,  227,
-      227,  227,  227,  227,  227,  227,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  330,  610,  610,  610,  610,  304,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  350,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  378,
-      610,  610,  390,  390,  390,  390,  390,  390,  390,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  236,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  479,  479,  479,  479,  479,  479,  399,  399,
-      399,  399,  399,  399,  553,  559,    0,    0,    0,    0,
-      604,    0,  596,  577,  580,  610,  610,  578,  584,    0,
-
-        0,    0,    0,    0,    0,  594,  542,    0,  603,  599,
-      582,  581,  586,  589,    0,    0,  587,  593,  524,  524,
-      524,  524,  524,  524,  524,  524,  610,  610,  610,  610,
-        5,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,   21,   21,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,   53,  610,  610,  610,
-      610,  610,  118,  610,  610,   67,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  227,  227,  227,
-
-      227,  227,  227,  227,  227,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  302,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  390,  390,  383,
-      610,  610,  610,  610,  610,  264,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  479,  479,  399,  399,  542,    0,  603,
-
-      599,  582,  581,  586,  589,    0,    0,  587,  593,  602,
-      591,  590,  524,  524,  610,  610,  610,  610,    1,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,   73,  610,  610,
-      610,  610,  610,  610,  610,  610,   57,  610,  610,  610,
-      610,  610,  610,  189,  181,  610,  610,  610,  610,  183,
-      193,  610,  610,  610,  610,  610,  610,  610,  610,  227,
-      227,  610,  610,  486,  490,  488,  492,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  314,  306,  610,  610,  610,  294,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  376,  610,  610,  610,  610,  610,  252,  610,  610,
-      610,  610,  242,  240,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      442,  610,  610,  610,  610,  610,  610,  224,  452,  610,
-      610,  610,  610,  610,  610,  467,  602,  591,  590,  610,
-      610,  610,  610,  610,   35,  610,  610,  610,  610,  610,
-      610,  610,   17,  610,  610,  610,  610,   61,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,   51,  610,  610,  116,  610,   65,
-      610,  610,  610,  610,  610,  610,  610,  195,  185,  187,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  284,
-      610,  610,  610,  610,  610,  328,  326,  300,  322,  610,
-      610,  316,  610,  610,  610,  610,  348,  346,  610,  342,
-      610,  610,  336,  610,  610,  610,  372,  610,  610,  610,
-      246,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  272,  610,  610,  610,  610,  610,  610,
-      444,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,   39,  610,
-       27,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  100,  135,  610,  610,  610,  610,  110,  610,
-      610,   81,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  202,  610,  610,  199,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  204,  610,
-      610,  610,  610,  610,  610,  610,  610,  290,  610,  610,
-      610,  308,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  228,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  429,  610,
-
-      610,  610,  610,  610,  610,  417,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,   29,  610,  610,  610,  610,  610,  610,  610,
-       59,  610,  610,  610,  108,  610,  114,  610,  610,   79,
-      610,  610,  610,   47,  610,  610,  610,  610,  206,  610,
-      197,  191,  163,  159,  610,  610,  610,  161,  157,  610,
-      149,  610,  610,  208,  610,  610,  610,  610,  610,  610,
-      610,  610,  334,  332,  610,  610,  610,  354,  352,  610,
-      610,  610,  358,  610,  362,  380,  610,  268,  610,  238,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,   13,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  112,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  153,
-      155,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  318,  610,  312,  610,  610,  338,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  405,  610,  610,  610,  610,  415,  610,  610,
-      403,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  610,   43,  610,   41,  610,  610,  610,  610,
-      104,  610,  610,  610,  610,  610,  610,   45,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  167,  610,  610,
-      610,  610,  610,  482,  292,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  258,
-      610,  610,  280,  610,  610,  610,  610,  610,  610,  610,
-      610,  414,  610,  610,  473,  471,  610,  610,  469,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  102,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  175,
-      610,  173,  610,  610,  610,  165,  610,  610,  610,  496,
-
-      610,  610,  610,  610,  320,  610,  610,  340,  610,  610,
-      610,  610,  262,  610,  610,  278,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  465,  461,
-      610,  610,    3,   31,  610,  610,  610,  610,   63,  141,
-       83,  610,  610,  610,  610,  610,   87,  610,  610,  610,
-      610,  171,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  230,  610,  610,  266,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,   37,  610,  610,  610,  610,  610,  610,  610,
-       92,  610,  179,  610,  610,  610,  610,  610,  610,  610,
-
-      610,  610,  360,  610,  610,  256,  260,  274,  610,  610,
-      610,  412,  421,  610,  610,  610,  610,  610,  610,  463,
-      610,  610,  610,  610,  610,  610,  610,   85,  610,  610,
-      610,  177,  610,  610,  610,  610,  286,  610,  610,  610,
-      244,  610,  610,  610,  610,  610,  610,  610,  610,  440,
-      610,    7,  610,  610,  610,  610,  120,  610,   90,  610,
-      610,  145,  147,  494,  610,  610,  610,  610,  610,  610,
-      610,  610,  423,  610,  610,  610,  450,  610,  610,  610,
-      133,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,   55,
-
-      610,  288,  282,  610,  610,  270,  610,  610,  610,  610,
-      610,  419,   15,  610,  610,  610,  610,  610,  356,  610,
-      610,  610,  610,  610,   34,  131,  610,  610,  610,  276,
-      610,  610,  610,  610,  610,  169,  310,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      434,  610,  610,  427,  610,  610,  425,  610,   96,  436,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,   94,    0
+        0,    0,    0,  614,  614,  614,  614,  614,  614,  589,
+
+        0,    0,    0,    0,    0,    0,    0,  596,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,   27,
+      614,   23,   23,   23,   23,   23,   23,   23,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  141,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  145,  139,  614,  614,  614,  614,  614,
+      614,  614,  614,  153,  614,  614,  614,  614,  231,  231,
+
+      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  614,  614,  614,  614,  614,  488,  614,
+      614,  614,  614,  614,  614,  614,  302,  328,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  348,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  394,  394,  394,  394,  394,  394,  394,
+      394,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  238,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  413,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  483,  483,  483,  483,  483,
+      483,  483,  403,  403,  403,  403,  403,  403,  403,    0,
+        0,    0,    0,    0,    0,    0,    0,  614,  614,  614,
+      614,  614,  614,  589,    0,    0,    0,    0,    0,    0,
+        0,  596,  557,  563,    0,    0,    0,    0,  608,    0,
+      600,  581,  584,  614,  614,  582,  588,    0,    0,    0,
+        0,    0,    0,  598,  528,  528,  528,  528,  528,  528,
+      528,  528,  528,  528,  528,  528,  528,  614,   11,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,   23,   23,   23,   23,   23,   23,
+      614,  614,  614,  614,  614,  614,  614,  614,  100,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,   79,   77,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  231,  231,  231,  231,  231,  231,  231,
+      231,  231,  231,  231,  231,  231,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  334,  614,  614,  614,  614,  308,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  354,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  382,
+      614,  614,  394,  394,  394,  394,  394,  394,  394,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  240,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  483,  483,  483,  483,  483,  483,  403,  403,
+      403,  403,  403,  403,  557,  563,    0,    0,    0,    0,
+      608,    0,  600,  581,  584,  614,  614,  582,  588,    0,
+
+        0,    0,    0,    0,    0,  598,  546,    0,  607,  603,
+      586,  585,  590,  593,    0,    0,  591,  597,  528,  528,
+      528,  528,  528,  528,  528,  528,  614,  614,  614,  614,
+        5,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,   23,   23,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,   55,  614,  614,  614,
+      614,  614,  120,  614,  614,   69,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  231,  231,  231,
+
+      231,  231,  231,  231,  231,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  306,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  394,  394,  387,
+      614,  614,  614,  614,  614,  268,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  483,  483,  403,  403,  546,    0,  607,
+
+      603,  586,  585,  590,  593,    0,    0,  591,  597,  606,
+      595,  594,  528,  528,  614,  614,  614,  614,    1,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,   75,  614,  614,
+      614,  614,  614,  614,  614,  614,   59,  614,  614,  614,
+      614,  614,  614,  191,  183,  614,  614,  614,  614,  185,
+      195,  614,  614,  614,  614,  614,  614,  614,  614,  231,
+      231,  614,  614,  490,  494,  492,  496,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  318,  310,  614,  614,  614,  298,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  380,  614,  614,  614,  614,  614,  256,  614,  614,
+      614,  614,  246,  244,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      446,  614,  614,  614,  614,  614,  614,  228,  456,  614,
+      614,  614,  614,  614,  614,  471,  606,  595,  594,  614,
+      614,  614,  614,  614,   37,  614,  614,  614,  614,  614,
+      614,  614,   19,  614,  614,  614,  614,   63,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,   53,  614,  614,  118,  614,   67,
+      614,  614,  614,  614,  614,  614,  614,  197,  187,  189,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  288,
+      614,  614,  614,  614,  614,  332,  330,  304,  326,  614,
+      614,  320,  614,  614,  614,  614,  352,  350,  614,  346,
+      614,  614,  340,  614,  614,  614,  376,  614,  614,  614,
+      250,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  276,  614,  614,  614,  614,  614,  614,
+      448,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,   41,  614,
+       29,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  102,  137,  614,  614,  614,  614,  112,  614,
+      614,   83,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  206,  614,  614,  201,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  208,  614,
+      614,  614,  614,  614,  614,  614,  614,  294,  614,  614,
+      614,  312,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  232,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  433,  614,
+
+      614,  614,  614,  614,  614,  421,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,   31,  614,  614,  614,  614,  614,  614,  614,
+       61,  614,  614,  614,  110,  614,  116,  614,  614,   81,
+      614,  614,  614,   49,  614,  614,  614,  614,  210,  614,
+      199,  193,  165,  161,  614,  614,  614,  163,  159,  614,
+      151,  614,  614,  212,  614,  614,  614,  614,  614,  614,
+      614,  614,  338,  336,  614,  614,  614,  358,  356,  614,
+      614,  614,  362,  614,  366,  384,  614,  272,  614,  242,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,   15,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  114,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  155,
+      157,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  322,  614,  316,  614,  614,  342,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  409,  614,  614,  614,  614,  419,  614,  614,
+      407,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  614,   45,  614,   43,  614,  614,  614,  614,
+      106,  614,  614,  614,  614,  614,  614,   47,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  169,  614,  614,
+      614,  614,  614,  486,  296,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  262,
+      614,  614,  284,  614,  614,  614,  614,  614,  614,  614,
+      614,  418,  614,  614,  477,  475,  614,  614,  473,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  104,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  177,
+      614,  175,  614,  614,  614,  167,  614,  614,  614,  500,
+
+      614,  614,  614,  614,  324,  614,  614,  344,  614,  614,
+      614,  614,  266,  614,  614,  282,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  469,  465,
+      614,  614,    3,   33,  614,  614,  614,  614,   65,  143,
+       85,  614,  614,  614,  614,  614,   89,  614,  614,  614,
+      614,  173,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  234,  614,  614,  270,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,   39,  614,  614,  614,  614,  614,  614,  614,
+       94,  614,  181,  614,  614,  614,  614,  614,  614,  614,
+
+      614,  614,  364,  614,  614,  260,  264,  278,  614,  614,
+      614,  416,  425,  614,  614,  614,  614,  614,  614,  467,
+      614,  614,  614,  614,  614,  614,  614,   87,  614,  614,
+      614,  179,  614,  614,  614,  614,  290,  614,  614,  614,
+      248,  614,  614,  614,  614,  614,  614,  614,  614,  444,
+      614,    7,  614,  614,  614,  614,  122,  614,   92,  614,
+      614,  147,  149,  498,  614,  614,  614,  614,  614,  614,
+      614,  614,  427,  614,  614,  614,  454,  614,  614,  614,
+      135,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,   57,
+
+      614,  292,  286,  614,  614,  274,  614,  614,  614,  614,
+      614,  423,   17,  614,  614,  614,  614,  614,  360,  614,
+      614,  614,  614,  614,   36,  133,  614,  614,  614,  280,
+      614,  614,  614,  614,  614,  171,  314,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      438,  614,  614,  431,  614,  614,  429,  614,   98,  440,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,   96,    0,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  203,
+
+      614,  196,  204,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      614,  614,    9,  614,   10
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -1081,11 +1087,11 @@ static yyconst flex_int32_t yy_meta[76] =
         4,    4,    4,    4,    1
     } ;
 
-static yyconst flex_int16_t yy_base[6295] =
+static yyconst flex_int16_t yy_base[6343] =
     {   0,
-        0,   75,  150,    0,    0,    0,    0,    7,    5,   53,
+        0,   75,  150,    0,    0,    0,11680,    7,    5,   53,
         3,   45,  225,    0,    0,    0,  252,  271,    0,    0,
-        0,    0,   59,   68,  338,  413,  488,    0,  563,  638,
+        0,    0, 9628,   68,  338,  413,  488,    0,  563,  638,
        78,   79,  312,  315,  334,  343,  387,  397,  341,  393,
       713,    0,  415,  548,  553,  558,  613,  635, 9484, 9483,
        52,  318,   81,  389,  788,    0,  863,    0,  938, 1013,
@@ -1772,710 +1778,720 @@ static yyconst flex_int16_t yy_base[6295] =
      8916, 8915, 8913, 8931, 8911, 8932, 8933, 8926, 8921, 8925,
         0, 8941, 8929,    0, 8939, 8941,    0, 8927, 8947,    0,
      8934, 8928, 8937, 8949, 8947, 8935, 8954, 8940, 8950, 8957,
-     8956, 8958, 8941, 8956, 8943,    0, 9553, 9010, 9014, 9018,
-     9022, 9023, 9025, 9027, 9028, 9030, 9032, 9036, 9040, 9034,
-     9038, 9041, 9045, 9049
-
+     8956, 8958, 8941, 8956, 8943,    0, 9553, 9704, 9780, 9856,
+     9932,10008,10084,10160,10236,10312,10388,10464,10540,10616,
+    10692,10768,10844,10920,10996,11072,11148,11224,11300,11376,
+
+    11452,11528,11604,11756,11832,11908,11984,12060,12136,12212,
+    12288,12364,12440,12516,12592,12668,12744,12820,12896,12972,
+    13048,13124,13200,13276,13352, 9010, 9014, 9018, 9022, 9023,
+     9025, 9027, 9028, 9030, 9032, 9036, 9040, 9034, 9038, 9041,
+     9045, 9049
     } ;
 
-static yyconst flex_int16_t yy_def[6295] =
+static yyconst flex_int16_t yy_def[6343] =
     {   0,
-     6278, 6278, 6277,    3,    2,    2,    2,    2,    2,    2,
+     6326, 6326, 6277,    3,    2,    2,    2,    2,    2,    2,
         2,    2, 6277,   13,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2, 6279, 6279, 6277,   27, 6280, 6280,
+        2,    2,    2,    2, 6327, 6327, 6277,   27, 6328, 6328,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
      6277,   41,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2, 6277,   55, 6277,   57, 6281, 6281,
+        2,    2,    2,    2, 6277,   55, 6277,   57, 6329, 6329,
         2,    2, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282, 6282,
-     6277, 6277, 6277, 6277, 6283, 6277, 6277, 6277,   69, 6283,
-     6283, 6283, 6277, 6277, 6277, 6284, 6284, 6284, 6284, 6284,
-
-     6284, 6283, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6284, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6277, 6277,   69, 6277, 6277,
-     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6286, 6286, 6286, 6286, 6287,
-     6287, 6287, 6287, 6287, 6287, 6286, 6277, 6277, 6277, 6277,
-     6277,   69, 6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6282, 6277,
-     6277, 6288, 6277, 6289, 6277, 6277,   69, 6277, 6277, 6277,
-
-     6277, 6277, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277,   69, 6277,
-     6277, 6277, 6277, 6277, 6290, 6290, 6290, 6290, 6290, 6290,
-     6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6277, 6277,   69, 6277, 6277,
-     6277, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
-
-     6277, 6277,   69, 6277, 6277, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6292, 6292, 6293, 6293, 6277, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6294, 6294,  328,  328,
-      328,  328, 6293, 6277, 6277, 6282, 6282, 6282, 6282, 6282,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6283,
-     6283, 6283, 6283, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283, 6283,
-
-     6283, 6283, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6284, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6285, 6285, 6285,
-     6285, 6285, 6285, 6285, 6285, 6285, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6286, 6286,
-     6286, 6286, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6286,
-     6286, 6286, 6286, 6286, 6286, 6282, 6282, 6282, 6282, 6282,
-     6282, 6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277,
-     6277, 6277, 6277, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
-     6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6277, 6277, 6277, 6277, 6291, 6291,
-     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6277, 6277,
-     6277, 6277, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6293, 6277, 6293, 6293, 6293, 6277, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293,  328,  328,  328,  328,  328,  328,  328, 6293, 6293,
-     6293, 6293, 6293, 6293, 6277, 6282, 6282, 6282, 6282, 6282,
-     6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282,
-     6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6283, 6283,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6284, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6277, 6277, 6285, 6285, 6285, 6285, 6285, 6285,
-
-     6285, 6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6286, 6286, 6287, 6287, 6287, 6287,
-     6287, 6287, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6282,
-
-     6282, 6282, 6282, 6277, 6277, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277, 6290,
-     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277,
-     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6277, 6277,
-
-     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293,  328,  328,  328,  328,  328,  328, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6277, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277,
-
-     6277, 6277, 6277, 6277, 6277, 6283, 6284, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6285,
-     6285, 6285, 6277, 6285, 6285, 6285, 6285, 6285, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6286,
-     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6286, 6286, 6286,
-     6286, 6286, 6286, 6286, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6290, 6290, 6290, 6290, 6290,
-     6290, 6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6292, 6292, 6292, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293,  328,  328,  328,  328,  328,  328,  328,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330, 6330,
+     6277, 6277, 6277, 6277, 6331, 6277, 6277, 6277,   69, 6331,
+     6331, 6331, 6277, 6277, 6277, 6332, 6332, 6332, 6332, 6332,
+
+     6332, 6331, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6332, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6277, 6277,   69, 6277, 6277,
+     6333, 6333, 6333, 6333, 6333, 6333, 6333, 6333, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6334, 6334, 6334, 6334, 6335,
+     6335, 6335, 6335, 6335, 6335, 6334, 6277, 6277, 6277, 6277,
+     6277,   69, 6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6330, 6277,
+     6277, 6336, 6277, 6337, 6277, 6277,   69, 6277, 6277, 6277,
+
+     6277, 6277, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277,   69, 6277,
+     6277, 6277, 6277, 6277, 6338, 6338, 6338, 6338, 6338, 6338,
+     6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6277, 6277,   69, 6277, 6277,
+     6277, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339,
+
+     6277, 6277,   69, 6277, 6277, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6340, 6340, 6341, 6341, 6277, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6342, 6342,  328,  328,
+      328,  328, 6341, 6277, 6277, 6330, 6330, 6330, 6330, 6330,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6283, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6285, 6285,
-     6285, 6285, 6285, 6285, 6285, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6286, 6287, 6287, 6287, 6287, 6287,
-     6287, 6287, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6292, 6292,
-     6292, 6292, 6292, 6292, 6292, 6292, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293,  328,  328,  328,  328,  328,
-      328,  328, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6282, 6282, 6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6283, 6284, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
-     6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6286, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6286,
-     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
-     6290, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6291,
-     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6292, 6292, 6292,
-     6292, 6292, 6292, 6292, 6292, 6292, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-      328,  328,  328,  328,  328,  328,  328,  328, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6282, 6282, 6282, 6282,
-     6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6283, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283, 6283, 6283,
-     6283, 6283, 6283, 6283, 6284, 6284, 6284, 6284, 6284, 6284,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285,
-     6285, 6285, 6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6286, 6287, 6287, 6287, 6287,
-     6287, 6287, 6287, 6287, 6286, 6286, 6286, 6286, 6286, 6286,
-     6286, 6286, 6286, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6290, 6290, 6290,
-     6290, 6290, 6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293,  328,  328,  328,  328,  328,
-      328,  328,  328, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6331,
+     6331, 6331, 6331, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331, 6331,
+
+     6331, 6331, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6332, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6333, 6333, 6333,
+     6333, 6333, 6333, 6333, 6333, 6333, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6334, 6334,
+     6334, 6334, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6334,
+     6334, 6334, 6334, 6334, 6334, 6330, 6330, 6330, 6330, 6330,
+     6330, 6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277,
+     6277, 6277, 6277, 6338, 6338, 6338, 6338, 6338, 6338, 6338,
+     6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6277, 6277, 6277, 6277, 6339, 6339,
+     6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6277, 6277,
+     6277, 6277, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6341, 6277, 6341, 6341, 6341, 6277, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341,  328,  328,  328,  328,  328,  328,  328, 6341, 6341,
+     6341, 6341, 6341, 6341, 6277, 6330, 6330, 6330, 6330, 6330,
+     6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277, 6277,
 
-     6277, 6277, 6277, 6277, 6277, 6277, 6283, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283,
-     6283, 6283, 6283, 6283, 6283, 6283, 6284, 6284, 6284, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285,
-     6285, 6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6286, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
-     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293,  328,  328,  328,  328,
-      328,  328,  328,  328, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-
-     6277, 6277, 6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6283, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
-     6284, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285,
-     6285, 6285, 6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6286, 6287, 6287, 6287, 6287, 6287, 6287,
-     6287, 6287, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
-     6286, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
-     6290, 6290, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293,  328,  328,  328,  328,  328,  328,
-      328,  328, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-
+     6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330,
+     6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6331, 6331,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6332, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6277, 6277, 6333, 6333, 6333, 6333, 6333, 6333,
+
+     6333, 6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6334, 6334, 6335, 6335, 6335, 6335,
+     6335, 6335, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6330,
+
+     6330, 6330, 6330, 6277, 6277, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277, 6338,
+     6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277,
+     6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6277, 6277,
+
+     6340, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341,  328,  328,  328,  328,  328,  328, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6277, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6283, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283,
-     6283, 6283, 6283, 6283, 6283, 6283, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
-     6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6286, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
-     6287, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6290, 6290, 6290, 6290,
-     6290, 6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6291, 6291,
-     6291, 6291, 6291, 6291, 6291, 6291, 6292, 6292, 6292, 6292,
-     6292, 6292, 6292, 6292, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293,  328,  328,  328,  328,  328,  328,
-      328,  328, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-
-     6293, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6283, 6284, 6284, 6284, 6284,
-     6284, 6284, 6284, 6284, 6283, 6283, 6283, 6283, 6283, 6283,
-     6283, 6283, 6283, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6285,
-     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6286, 6287,
-     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6286, 6286, 6286,
-     6286, 6286, 6286, 6286, 6286, 6286, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6290, 6290, 6290, 6290, 6290,
-
-     6290, 6290, 6290, 6290, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,  328,
-      328,  328,  328,  328,  328,  328,  328, 6293, 6293, 6293,
-
-     6293, 6293, 6293, 6293, 6293, 6293, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6283, 6284,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283,
-     6283, 6283, 6283, 6283, 6283, 6283, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6286, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
-     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6290, 6290,
-
-     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291,
-     6291, 6291, 6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292,
-     6292, 6292, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293,  328,  328,  328,
-      328,  328,  328,  328,  328, 6293, 6293, 6293, 6293, 6293,
-
-     6293, 6293, 6293, 6293, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6283, 6283,
-     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
-     6285, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
-     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6290, 6290,
-     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
-     6291, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,  328,  328,
-      328,  328,  328,  328,  328,  328, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293, 6293, 6293, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6284, 6284,
-     6284, 6284, 6284, 6284, 6284, 6283, 6283, 6283, 6283, 6283,
-     6283, 6283, 6283, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6287, 6287,
-
-     6287, 6287, 6287, 6287, 6287, 6286, 6286, 6286, 6286, 6286,
-     6286, 6286, 6286, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
-     6290, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6291, 6291, 6291, 6291, 6291,
-     6291, 6291, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6293,
-     6293, 6293, 6293, 6293, 6293, 6293, 6293,  328,  328,  328,
-      328,  328,  328,  328, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6282, 6282, 6282, 6282, 6282, 6282, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6284, 6284, 6284, 6284, 6284, 6284,
-     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6285, 6285, 6285, 6285, 6285, 6285,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6287, 6287, 6287, 6287, 6287, 6287, 6286,
-     6286, 6286, 6286, 6286, 6286, 6286, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6291, 6291, 6291, 6291, 6291, 6291, 6292, 6292,
-     6292, 6292, 6292, 6292, 6293, 6293, 6293, 6293, 6293, 6293,
-     6293, 6293, 6293,  328,  328,  328,  328,  328,  328, 6293,
-
-     6293, 6293, 6293, 6293, 6293, 6293, 6277, 6277, 6277, 6277,
-     6282, 6282, 6277, 6277, 6277, 6277, 6277, 6277, 6284, 6284,
-     6283, 6283, 6283, 6283, 6283, 6283, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6285, 6285, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6287, 6287, 6286,
-
-     6286, 6286, 6286, 6286, 6286, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6290, 6290, 6290,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6291, 6291, 6292, 6292, 6293, 6293, 6293,
-
-     6293,  328,  328, 6293, 6293, 6293, 6293, 6293, 6293, 6277,
-     6277, 6277, 6283, 6283, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6286,
-     6286, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6293, 6293, 6293, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277,
+
+     6277, 6277, 6277, 6277, 6277, 6331, 6332, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6331, 6331, 6331, 6331, 6331, 6331, 6331, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6333,
+     6333, 6333, 6277, 6333, 6333, 6333, 6333, 6333, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6334,
+     6335, 6335, 6335, 6335, 6335, 6335, 6335, 6334, 6334, 6334,
+     6334, 6334, 6334, 6334, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6338, 6338, 6338, 6338, 6338,
+     6338, 6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6340, 6340, 6340, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341,  328,  328,  328,  328,  328,  328,  328,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
 
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6331, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6333, 6333,
+     6333, 6333, 6333, 6333, 6333, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6334, 6335, 6335, 6335, 6335, 6335,
+     6335, 6335, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6340, 6340,
+     6340, 6340, 6340, 6340, 6340, 6340, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341,  328,  328,  328,  328,  328,
+      328,  328, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6330, 6330, 6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6331, 6332, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6331, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333, 6333,
+     6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6334, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6334,
+     6334, 6334, 6334, 6334, 6334, 6334, 6334, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338,
+     6338, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6339,
+     6339, 6339, 6339, 6339, 6339, 6339, 6339, 6340, 6340, 6340,
+     6340, 6340, 6340, 6340, 6340, 6340, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+      328,  328,  328,  328,  328,  328,  328,  328, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6330, 6330, 6330, 6330,
+     6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6331, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331, 6331, 6331,
+     6331, 6331, 6331, 6331, 6332, 6332, 6332, 6332, 6332, 6332,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333,
+     6333, 6333, 6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6334, 6335, 6335, 6335, 6335,
+     6335, 6335, 6335, 6335, 6334, 6334, 6334, 6334, 6334, 6334,
+     6334, 6334, 6334, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6338, 6338, 6338,
+     6338, 6338, 6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341,  328,  328,  328,  328,  328,
+      328,  328,  328, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6331, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331,
+     6331, 6331, 6331, 6331, 6331, 6331, 6332, 6332, 6332, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333,
+     6333, 6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6334, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6335,
+     6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6338,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341,  328,  328,  328,  328,
+      328,  328,  328,  328, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6331, 6332, 6332, 6332, 6332, 6332, 6332, 6332,
+     6332, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6331, 6331,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333,
+     6333, 6333, 6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6334, 6335, 6335, 6335, 6335, 6335, 6335,
+     6335, 6335, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334,
+     6334, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6338, 6338, 6338, 6338, 6338, 6338, 6338,
+     6338, 6338, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341,  328,  328,  328,  328,  328,  328,
+      328,  328, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
 
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
-     6282, 6282, 6282, 6282, 6282, 6282,    0, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277
+     6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6331, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331,
+     6331, 6331, 6331, 6331, 6331, 6331, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333, 6333,
+     6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6334, 6335, 6335, 6335, 6335, 6335, 6335, 6335,
+     6335, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6338, 6338, 6338, 6338,
+     6338, 6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6339, 6339,
+     6339, 6339, 6339, 6339, 6339, 6339, 6340, 6340, 6340, 6340,
+     6340, 6340, 6340, 6340, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341,  328,  328,  328,  328,  328,  328,
+      328,  328, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+
+     6341, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6331, 6332, 6332, 6332, 6332,
+     6332, 6332, 6332, 6332, 6331, 6331, 6331, 6331, 6331, 6331,
+     6331, 6331, 6331, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6333,
+     6333, 6333, 6333, 6333, 6333, 6333, 6333, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6334, 6335,
+     6335, 6335, 6335, 6335, 6335, 6335, 6335, 6334, 6334, 6334,
+     6334, 6334, 6334, 6334, 6334, 6334, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6338, 6338, 6338, 6338, 6338,
+
+     6338, 6338, 6338, 6338, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,  328,
+      328,  328,  328,  328,  328,  328,  328, 6341, 6341, 6341,
+
+     6341, 6341, 6341, 6341, 6341, 6341, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6331, 6332,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331,
+     6331, 6331, 6331, 6331, 6331, 6331, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333, 6333, 6333,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6334, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6335,
+     6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6338, 6338,
+
+     6338, 6338, 6338, 6338, 6338, 6338, 6338, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339,
+     6339, 6339, 6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340,
+     6340, 6340, 6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341,  328,  328,  328,
+      328,  328,  328,  328,  328, 6341, 6341, 6341, 6341, 6341,
+
+     6341, 6341, 6341, 6341, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6332, 6332, 6332, 6332, 6332, 6332, 6332, 6332, 6331, 6331,
+     6331, 6331, 6331, 6331, 6331, 6331, 6331, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333, 6333,
+     6333, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6335, 6335, 6335, 6335, 6335, 6335, 6335, 6335,
+     6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6334, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6338, 6338,
+     6338, 6338, 6338, 6338, 6338, 6338, 6338, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6339, 6339, 6339, 6339, 6339, 6339, 6339,
+     6339, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341, 6341,  328,  328,
+      328,  328,  328,  328,  328,  328, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341, 6341, 6341, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6332, 6332,
+     6332, 6332, 6332, 6332, 6332, 6331, 6331, 6331, 6331, 6331,
+     6331, 6331, 6331, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6333, 6333, 6333, 6333, 6333, 6333, 6333, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6335, 6335,
+
+     6335, 6335, 6335, 6335, 6335, 6334, 6334, 6334, 6334, 6334,
+     6334, 6334, 6334, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6338, 6338, 6338, 6338, 6338, 6338, 6338,
+     6338, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6339, 6339, 6339, 6339, 6339,
+     6339, 6339, 6340, 6340, 6340, 6340, 6340, 6340, 6340, 6341,
+     6341, 6341, 6341, 6341, 6341, 6341, 6341,  328,  328,  328,
+      328,  328,  328,  328, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6330, 6330, 6330, 6330, 6330, 6330, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6332, 6332, 6332, 6332, 6332, 6332,
+     6331, 6331, 6331, 6331, 6331, 6331, 6331, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6333, 6333, 6333, 6333, 6333, 6333,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6335, 6335, 6335, 6335, 6335, 6335, 6334,
+     6334, 6334, 6334, 6334, 6334, 6334, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6338, 6338, 6338, 6338, 6338, 6338, 6338, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6339, 6339, 6339, 6339, 6339, 6339, 6340, 6340,
+     6340, 6340, 6340, 6340, 6341, 6341, 6341, 6341, 6341, 6341,
+     6341, 6341, 6341,  328,  328,  328,  328,  328,  328, 6341,
+
+     6341, 6341, 6341, 6341, 6341, 6341, 6277, 6277, 6277, 6277,
+     6330, 6330, 6277, 6277, 6277, 6277, 6277, 6277, 6332, 6332,
+     6331, 6331, 6331, 6331, 6331, 6331, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6333, 6333, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6335, 6335, 6334,
+
+     6334, 6334, 6334, 6334, 6334, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6338, 6338, 6338,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6339, 6339, 6340, 6340, 6341, 6341, 6341,
+
+     6341,  328,  328, 6341, 6341, 6341, 6341, 6341, 6341, 6277,
+     6277, 6277, 6331, 6331, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6334,
+     6334, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6341, 6341, 6341, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330, 6330,
+     6330, 6330, 6330, 6330, 6330, 6330,    0, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
 
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277
     } ;
 
-static yyconst flex_int16_t yy_nxt[9629] =
+static yyconst flex_int16_t yy_nxt[13429] =
     {   0,
        64,   65,   65,   64,   66,   64,   67,   68,   64,   69,
        64,   64,   70,   70,   70,   70,   71,   70,   70,   70,
@@ -3535,10 +3551,428 @@ static yyconst flex_int16_t yy_nxt[9629] =
 
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,   64,   65,
+       65,   64,   66,   64,   67,   68,   64,   69,   64,   64,
+       70,   70,   70,   70,   71,   70,   70,   70,   72,   73,
+       74,   75,   75,   76,   75,   75,   75,   75,   75,   77,
+       75,   75,   75,   75,   75,   75,   78,   75,   75,   79,
+       80,   75,   75,   75,   75,   81,   75,   75,   75,   75,
+       75,   75,   75,  151,   75,   75,   75,   75,   75,   75,
+     6278,   75,   75,  153,  154,  155,   75,   75,   75,   75,
+
+       75,   75,   64,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  497,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367, 6301,
+      367,  499, 6279,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367, 6280,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367, 6281,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+     6282,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6283,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367, 6284,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 2893,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6285,  367, 2895,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6286,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6287,  367,
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6288,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367, 6289,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367, 6290,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367, 6291,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     4950,  367, 4951,  367,  367, 4952, 4953, 4954,  367,  367,
+      367,  367, 4955,  367,  367,  367,  367,  367, 6292, 4956,
+      367,  367, 4957,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6293,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6294,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367, 6295,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367, 6296,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6297,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367, 6298,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6299,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6300,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      958,  367,  959,  367,  367,  960,  961,  962,  367,  367,
+      367,  367,  963,  367,  367,  367,  367,  367, 6302,  965,
+      367,  367,  966,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6303,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+       64,   65,   65,   64,   66,   64,   67,   68,   64,   69,
+       64,   64,   70,   70,   70,   70,   71,   70,   70,   70,
+
+       72,   73,   74,   75,   75,   76,   75,   75,   75,   75,
+       75,   77,   75,   75,   75,   75,   75,   75,   78,   75,
+       75,   79,   80,   75,   75,   75,   75,   81,  113,   75,
+      114,   75,  115,   75,   75,   75,   75,   75,  116,   75,
+      117,  118,   75, 6304,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   64,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  426,  367,  367,
+      367,  367, 6305,  367,  367,  367,  367,  367,  367,  367,
+      367,  427,  367, 6324,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367, 6306,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6307,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367, 6308,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6309,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367, 6310,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6311,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6312,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367, 6313,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367, 6314,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367, 6315,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367, 6316,
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6317,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367, 6318,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6319,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367, 6320,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367, 6321,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277,    0, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+      367,  367,  367,  367,  367,  367,  367,  367, 6277, 6277,
+     6277,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+     6322,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277,    0, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277, 6277, 6277,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6323,  367,  367,  367,  367,  367,  367,  367, 6277,    0,
+
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277, 6277, 6277,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367, 6277,    0, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277, 6277, 6277,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6325,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+     6277,    0, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
+     6277, 6277, 6277, 6277,  367,  367,  367,  367,  367,  367,
+      367,  367, 6277, 6277, 6277,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367, 6277,    0
     } ;
 
-static yyconst flex_int16_t yy_chk[9629] =
+static yyconst flex_int16_t yy_chk[13429] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -4531,11 +4965,11 @@ static yyconst flex_int16_t yy_chk[9629] =
      6253, 6255, 6256, 6258, 6259, 6261, 6262, 6263, 6264, 6265,
 
      6266, 6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275,
-     6278, 6278, 6278, 6278, 6279, 6279, 6279, 6279, 6280, 6280,
-     6280, 6280, 6281, 6281, 6281, 6281, 6282, 6283, 6283, 6284,
-     6284, 6285, 6286, 6286, 6287, 6287, 6288, 6290, 6288, 6288,
-     6289, 6291, 6289, 6289, 6292, 6293, 6293, 6293, 6293, 6294,
-     6294, 6294, 6294, 1051, 1050, 1046, 1044, 1043, 1042, 1041,
+     6326, 6326, 6326, 6326, 6327, 6327, 6327, 6327, 6328, 6328,
+     6328, 6328, 6329, 6329, 6329, 6329, 6330, 6331, 6331, 6332,
+     6332, 6333, 6334, 6334, 6335, 6335, 6336, 6338, 6336, 6336,
+     6337, 6339, 6337, 6337, 6340, 6341, 6341, 6341, 6341, 6342,
+     6342, 6342, 6342, 1051, 1050, 1046, 1044, 1043, 1042, 1041,
      1040, 1038, 1036, 1035, 1034, 1032, 1031, 1030, 1029, 1028,
      1027, 1026, 1025, 1024, 1022, 1021, 1019, 1018, 1017, 1016,
      1015, 1013, 1012, 1011, 1009, 1008, 1007, 1006,  999,  998,
@@ -4598,7 +5032,425 @@ static yyconst flex_int16_t yy_chk[9629] =
 
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
      6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,
-     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277
+     6277, 6277, 6277, 6277, 6277, 6277, 6277, 6277,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+
+       23,   23,   23,    0, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+     6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,    0,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279, 6279,
+     6279, 6279, 6279, 6279, 6279,    0, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280, 6280,
+     6280,    0, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+     6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281, 6281,
+
+     6281, 6281, 6281, 6281, 6281, 6281, 6281,    0, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282, 6282,
+     6282, 6282, 6282,    0, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,
+     6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283, 6283,    0,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6284,
+     6284, 6284, 6284, 6284, 6284,    0, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+
+     6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285, 6285,
+     6285,    0, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286, 6286,
+     6286, 6286, 6286, 6286, 6286, 6286, 6286,    0, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287, 6287,
+     6287, 6287, 6287,    0, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,
+     6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288, 6288,    0,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+
+     6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
+     6289, 6289, 6289, 6289, 6289,    0, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290, 6290,
+     6290,    0, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291, 6291,
+     6291, 6291, 6291, 6291, 6291, 6291, 6291,    0, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292, 6292,
+     6292, 6292, 6292,    0, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+     6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,    0,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+     6294, 6294, 6294, 6294, 6294,    0, 6295, 6295, 6295, 6295,
+
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295, 6295,
+     6295,    0, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296,
+     6296, 6296, 6296, 6296, 6296, 6296, 6296,    0, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297, 6297,
+     6297, 6297, 6297,    0, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,
+     6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298, 6298,    0,
+
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+     6299, 6299, 6299, 6299, 6299,    0, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+     6300,    0, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301, 6301,
+     6301, 6301, 6301, 6301, 6301, 6301, 6301,    0, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+     6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302, 6302,
+
+     6302, 6302, 6302,    0, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,
+     6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303, 6303,    0,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    0, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304, 6304,
+     6304,    0, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+     6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305, 6305,
+
+     6305, 6305, 6305, 6305, 6305, 6305, 6305,    0, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306, 6306,
+     6306, 6306, 6306,    0, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,
+     6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307, 6307,    0,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308, 6308,
+     6308, 6308, 6308, 6308, 6308,    0, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+
+     6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309, 6309,
+     6309,    0, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310, 6310,
+     6310, 6310, 6310, 6310, 6310, 6310, 6310,    0, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311, 6311,
+     6311, 6311, 6311,    0, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,
+     6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312,    0,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+
+     6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313, 6313,
+     6313, 6313, 6313, 6313, 6313,    0, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+     6314,    0, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+     6315, 6315, 6315, 6315, 6315, 6315, 6315,    0, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316, 6316,
+     6316, 6316, 6316,    0, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,
+     6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317, 6317,    0,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318, 6318,
+     6318, 6318, 6318, 6318, 6318,    0, 6319, 6319, 6319, 6319,
+
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+     6319,    0, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
+     6320, 6320, 6320, 6320, 6320, 6320, 6320,    0, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321, 6321,
+     6321, 6321, 6321,    0, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,
+     6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322, 6322,    0,
+
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323, 6323,
+     6323, 6323, 6323, 6323, 6323,    0, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324, 6324,
+     6324,    0, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325, 6325,
+     6325, 6325, 6325, 6325, 6325, 6325, 6325,    0
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -4680,7 +5532,7 @@ using namespace std;
 
 
 
-#line 4684 "parameters_flexer.cc"
+#line 5536 "parameters_flexer.cc"
 
 #define INITIAL 0
 #define JOB_MODE 1
@@ -4818,7 +5670,7 @@ YY_DECL
 #line 85 "parameters_flexer.ll"
 
 
-#line 4822 "parameters_flexer.cc"
+#line 5674 "parameters_flexer.cc"
 
 	if ( !(yy_init) )
 		{
@@ -4871,7 +5723,7 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 6278 )
+				if ( yy_current_state >= 6326 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4930,59 +5782,56 @@ YY_RULE_SETUP
 { yy_push_state(ASK_YN_MODE); return MP_as_automemmanagement;}
 	YY_BREAK
 case 9:
-#line 97 "parameters_flexer.ll"
+#line 96 "parameters_flexer.ll"
 case 10:
 YY_RULE_SETUP
-#line 97 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_cleanup_tmp_files;}
+#line 96 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_pinthreads;}
 	YY_BREAK
 case 11:
-#line 100 "parameters_flexer.ll"
+#line 99 "parameters_flexer.ll"
 case 12:
 YY_RULE_SETUP
-#line 100 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_nodateoutput;}
+#line 99 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_cleanup_tmp_files;}
 	YY_BREAK
 case 13:
 #line 102 "parameters_flexer.ll"
 case 14:
 YY_RULE_SETUP
 #line 102 "parameters_flexer.ll"
-{ return MP_sp_est_startstep;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_nodateoutput;}
 	YY_BREAK
 case 15:
 #line 104 "parameters_flexer.ll"
 case 16:
 YY_RULE_SETUP
 #line 104 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_buntify_reads;}
+{ return MP_sp_est_startstep;}
 	YY_BREAK
 case 17:
-#line 108 "parameters_flexer.ll"
+#line 106 "parameters_flexer.ll"
 case 18:
 YY_RULE_SETUP
-#line 108 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_as_wants_qualityfile;}
+#line 106 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_buntify_reads;}
 	YY_BREAK
 case 19:
-YY_RULE_SETUP
 #line 110 "parameters_flexer.ll"
-{ BEGIN(LR_MODE); return E_QUAL_NONE;}
-	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 111 "parameters_flexer.ll"
-{ BEGIN(LR_MODE); return E_QUAL_SCF;}
+#line 110 "parameters_flexer.ll"
+{yy_push_state(ASK_YN_MODE); return MP_as_wants_qualityfile;}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 112 "parameters_flexer.ll"
-{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+{ BEGIN(LR_MODE); return E_QUAL_NONE;}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 113 "parameters_flexer.ll"
-{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+{ BEGIN(LR_MODE); return E_QUAL_SCF;}
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
@@ -4990,452 +5839,455 @@ YY_RULE_SETUP
 { BEGIN(0); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 24:
-/* rule 24 can match eol */
 YY_RULE_SETUP
 #line 115 "parameters_flexer.ll"
 { BEGIN(0); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 25:
-#line 117 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 116 "parameters_flexer.ll"
+{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+	YY_BREAK
 case 26:
+/* rule 26 can match eol */
 YY_RULE_SETUP
 #line 117 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_filecheck_only;}
+{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 27:
-#line 121 "parameters_flexer.ll"
+#line 119 "parameters_flexer.ll"
 case 28:
 YY_RULE_SETUP
-#line 121 "parameters_flexer.ll"
-{ return MP_as_backbone_raillength;}
+#line 119 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_filecheck_only;}
 	YY_BREAK
 case 29:
 #line 123 "parameters_flexer.ll"
 case 30:
 YY_RULE_SETUP
 #line 123 "parameters_flexer.ll"
-{ return MP_as_backbone_railoverlap;}
+{ return MP_as_backbone_raillength;}
 	YY_BREAK
 case 31:
 #line 125 "parameters_flexer.ll"
 case 32:
 YY_RULE_SETUP
 #line 125 "parameters_flexer.ll"
-{ filenameid=MP_as_backbone_rail_fromstrain; yy_push_state(FN_MODE);}
+{ return MP_as_backbone_railoverlap;}
 	YY_BREAK
 case 33:
 #line 127 "parameters_flexer.ll"
 case 34:
 YY_RULE_SETUP
 #line 127 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_strainname_forceforall;}
+{ filenameid=MP_as_backbone_rail_fromstrain; yy_push_state(FN_MODE);}
 	YY_BREAK
 case 35:
 #line 129 "parameters_flexer.ll"
 case 36:
 YY_RULE_SETUP
 #line 129 "parameters_flexer.ll"
-{ return MP_as_backbone_basequals;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_strainname_forceforall;}
 	YY_BREAK
 case 37:
 #line 131 "parameters_flexer.ll"
 case 38:
 YY_RULE_SETUP
 #line 131 "parameters_flexer.ll"
-{ return MP_as_startbackboneusage_inpass;}
+{ return MP_as_backbone_basequals;}
 	YY_BREAK
 case 39:
 #line 133 "parameters_flexer.ll"
 case 40:
 YY_RULE_SETUP
 #line 133 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_alsobuildnewcontigs;}
+{ return MP_as_startbackboneusage_inpass;}
 	YY_BREAK
 case 41:
 #line 135 "parameters_flexer.ll"
 case 42:
 YY_RULE_SETUP
 #line 135 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_trimoverhangingreads;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_alsobuildnewcontigs;}
 	YY_BREAK
 case 43:
 #line 137 "parameters_flexer.ll"
 case 44:
 YY_RULE_SETUP
 #line 137 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_bootstrapnewbackbone;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_trimoverhangingreads;}
 	YY_BREAK
 case 45:
-#line 141 "parameters_flexer.ll"
+#line 139 "parameters_flexer.ll"
 case 46:
 YY_RULE_SETUP
-#line 141 "parameters_flexer.ll"
-{ return MP_as_clip_ssahamerge_strictfrontclip;}
+#line 139 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_backbone_bootstrapnewbackbone;}
 	YY_BREAK
 case 47:
 #line 143 "parameters_flexer.ll"
 case 48:
 YY_RULE_SETUP
 #line 143 "parameters_flexer.ll"
-{ return MP_as_clip_ssahamerge_strictendclip;}
+{ return MP_as_clip_ssahamerge_strictfrontclip;}
 	YY_BREAK
 case 49:
 #line 145 "parameters_flexer.ll"
 case 50:
 YY_RULE_SETUP
 #line 145 "parameters_flexer.ll"
-{ return MP_as_clip_ssahamerge_gapsize;}
+{ return MP_as_clip_ssahamerge_strictendclip;}
 	YY_BREAK
 case 51:
 #line 147 "parameters_flexer.ll"
 case 52:
 YY_RULE_SETUP
 #line 147 "parameters_flexer.ll"
-{ return MP_as_clip_ssahamerge_maxfrontgap;}
+{ return MP_as_clip_ssahamerge_gapsize;}
 	YY_BREAK
 case 53:
 #line 149 "parameters_flexer.ll"
 case 54:
 YY_RULE_SETUP
 #line 149 "parameters_flexer.ll"
-{ return MP_as_clip_ssahamerge_maxendgap;}
+{ return MP_as_clip_ssahamerge_maxfrontgap;}
 	YY_BREAK
 case 55:
 #line 151 "parameters_flexer.ll"
 case 56:
 YY_RULE_SETUP
 #line 151 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_possible_vectors;}
+{ return MP_as_clip_ssahamerge_maxendgap;}
 	YY_BREAK
 case 57:
 #line 153 "parameters_flexer.ll"
 case 58:
 YY_RULE_SETUP
 #line 153 "parameters_flexer.ll"
-{ return MP_as_clip_vector_maxlenallowed;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_possible_vectors;}
 	YY_BREAK
 case 59:
 #line 155 "parameters_flexer.ll"
 case 60:
 YY_RULE_SETUP
 #line 155 "parameters_flexer.ll"
-{ return MP_as_clip_badstretchquality_minqual;}
+{ return MP_as_clip_vector_maxlenallowed;}
 	YY_BREAK
 case 61:
 #line 157 "parameters_flexer.ll"
 case 62:
 YY_RULE_SETUP
 #line 157 "parameters_flexer.ll"
-{ return MP_as_clip_badstretchquality_winlen;}
+{ return MP_as_clip_badstretchquality_minqual;}
 	YY_BREAK
 case 63:
 #line 159 "parameters_flexer.ll"
 case 64:
 YY_RULE_SETUP
 #line 159 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_badstretchquality;}
+{ return MP_as_clip_badstretchquality_winlen;}
 	YY_BREAK
 case 65:
 #line 161 "parameters_flexer.ll"
 case 66:
 YY_RULE_SETUP
 #line 161 "parameters_flexer.ll"
-{ return MP_as_clip_quality_minqual;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_badstretchquality;}
 	YY_BREAK
 case 67:
 #line 163 "parameters_flexer.ll"
 case 68:
 YY_RULE_SETUP
 #line 163 "parameters_flexer.ll"
-{ return MP_as_clip_quality_winlen;}
+{ return MP_as_clip_quality_minqual;}
 	YY_BREAK
 case 69:
 #line 165 "parameters_flexer.ll"
 case 70:
 YY_RULE_SETUP
 #line 165 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_quality;}
+{ return MP_as_clip_quality_winlen;}
 	YY_BREAK
 case 71:
 #line 167 "parameters_flexer.ll"
 case 72:
 YY_RULE_SETUP
 #line 167 "parameters_flexer.ll"
-{ return MP_as_clip_maskedbases_gapsize;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_quality;}
 	YY_BREAK
 case 73:
 #line 169 "parameters_flexer.ll"
 case 74:
 YY_RULE_SETUP
 #line 169 "parameters_flexer.ll"
-{ return MP_as_clip_maskedbases_maxfrontgap;}
+{ return MP_as_clip_maskedbases_gapsize;}
 	YY_BREAK
 case 75:
 #line 171 "parameters_flexer.ll"
 case 76:
 YY_RULE_SETUP
 #line 171 "parameters_flexer.ll"
-{ return MP_as_clip_maskedbases_maxendgap;}
+{ return MP_as_clip_maskedbases_maxfrontgap;}
 	YY_BREAK
 case 77:
 #line 173 "parameters_flexer.ll"
 case 78:
 YY_RULE_SETUP
 #line 173 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_maskedbases;}
+{ return MP_as_clip_maskedbases_maxendgap;}
 	YY_BREAK
 case 79:
 #line 175 "parameters_flexer.ll"
 case 80:
 YY_RULE_SETUP
 #line 175 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_lowercase_front;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_maskedbases;}
 	YY_BREAK
 case 81:
 #line 177 "parameters_flexer.ll"
 case 82:
 YY_RULE_SETUP
 #line 177 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_lowercase_back;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_lowercase_front;}
 	YY_BREAK
 case 83:
 #line 179 "parameters_flexer.ll"
 case 84:
 YY_RULE_SETUP
 #line 179 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_ensureminimumleftclip;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_lowercase_back;}
 	YY_BREAK
 case 85:
 #line 181 "parameters_flexer.ll"
 case 86:
 YY_RULE_SETUP
 #line 181 "parameters_flexer.ll"
-{ return MP_as_clip_minimumleftcliprequired;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_ensureminimumleftclip;}
 	YY_BREAK
 case 87:
 #line 183 "parameters_flexer.ll"
 case 88:
 YY_RULE_SETUP
 #line 183 "parameters_flexer.ll"
-{ return MP_as_clip_setminimumleftclip;}
+{ return MP_as_clip_minimumleftcliprequired;}
 	YY_BREAK
 case 89:
+#line 185 "parameters_flexer.ll"
+case 90:
 YY_RULE_SETUP
-#line 184 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_ensureminimumrightclip;}
+#line 185 "parameters_flexer.ll"
+{ return MP_as_clip_setminimumleftclip;}
 	YY_BREAK
-case 90:
-#line 186 "parameters_flexer.ll"
 case 91:
 YY_RULE_SETUP
 #line 186 "parameters_flexer.ll"
-{ return MP_as_clip_minimumrightcliprequired;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_ensureminimumrightclip;}
 	YY_BREAK
 case 92:
 #line 188 "parameters_flexer.ll"
 case 93:
 YY_RULE_SETUP
 #line 188 "parameters_flexer.ll"
-{ return MP_as_clip_setminimumrightclip;}
+{ return MP_as_clip_minimumrightcliprequired;}
 	YY_BREAK
 case 94:
 #line 190 "parameters_flexer.ll"
 case 95:
 YY_RULE_SETUP
 #line 190 "parameters_flexer.ll"
-{ return MP_as_clip_quality_numminthreshold;}
+{ return MP_as_clip_setminimumrightclip;}
 	YY_BREAK
 case 96:
 #line 192 "parameters_flexer.ll"
 case 97:
 YY_RULE_SETUP
 #line 192 "parameters_flexer.ll"
-{ return MP_as_clip_quality_minthreshold;}
+{ return MP_as_clip_quality_numminthreshold;}
 	YY_BREAK
 case 98:
-#line 195 "parameters_flexer.ll"
+#line 194 "parameters_flexer.ll"
 case 99:
 YY_RULE_SETUP
-#line 195 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_as_clip_3ppolybase;}
+#line 194 "parameters_flexer.ll"
+{ return MP_as_clip_quality_minthreshold;}
 	YY_BREAK
 case 100:
 #line 197 "parameters_flexer.ll"
 case 101:
 YY_RULE_SETUP
 #line 197 "parameters_flexer.ll"
-{return MP_as_clip_3ppolybase_len;}
+{yy_push_state(ASK_YN_MODE); return MP_as_clip_3ppolybase;}
 	YY_BREAK
 case 102:
 #line 199 "parameters_flexer.ll"
 case 103:
 YY_RULE_SETUP
 #line 199 "parameters_flexer.ll"
-{return MP_as_clip_3ppolybase_maxerrors;}
+{return MP_as_clip_3ppolybase_len;}
 	YY_BREAK
 case 104:
 #line 201 "parameters_flexer.ll"
 case 105:
 YY_RULE_SETUP
 #line 201 "parameters_flexer.ll"
-{return MP_as_clip_3ppolybase_maxgap;}
+{return MP_as_clip_3ppolybase_maxerrors;}
 	YY_BREAK
 case 106:
-#line 204 "parameters_flexer.ll"
+#line 203 "parameters_flexer.ll"
 case 107:
 YY_RULE_SETUP
-#line 204 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_as_clip_polyat;}
+#line 203 "parameters_flexer.ll"
+{return MP_as_clip_3ppolybase_maxgap;}
 	YY_BREAK
 case 108:
 #line 206 "parameters_flexer.ll"
 case 109:
 YY_RULE_SETUP
 #line 206 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_as_clip_polyat_keeppolystretch;}
+{yy_push_state(ASK_YN_MODE); return MP_as_clip_polyat;}
 	YY_BREAK
 case 110:
 #line 208 "parameters_flexer.ll"
 case 111:
 YY_RULE_SETUP
 #line 208 "parameters_flexer.ll"
-{return MP_as_clip_polyat_len;}
+{yy_push_state(ASK_YN_MODE); return MP_as_clip_polyat_keeppolystretch;}
 	YY_BREAK
 case 112:
 #line 210 "parameters_flexer.ll"
 case 113:
 YY_RULE_SETUP
 #line 210 "parameters_flexer.ll"
-{return MP_as_clip_polyat_maxerrors;}
+{return MP_as_clip_polyat_len;}
 	YY_BREAK
 case 114:
 #line 212 "parameters_flexer.ll"
 case 115:
 YY_RULE_SETUP
 #line 212 "parameters_flexer.ll"
-{return MP_as_clip_polyat_maxgap;}
+{return MP_as_clip_polyat_maxerrors;}
 	YY_BREAK
 case 116:
-#line 215 "parameters_flexer.ll"
+#line 214 "parameters_flexer.ll"
 case 117:
 YY_RULE_SETUP
-#line 215 "parameters_flexer.ll"
-{ return MP_as_clip_pec_basesperhash;}
+#line 214 "parameters_flexer.ll"
+{return MP_as_clip_polyat_maxgap;}
 	YY_BREAK
 case 118:
 #line 217 "parameters_flexer.ll"
 case 119:
 YY_RULE_SETUP
 #line 217 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_proposeendclips;}
+{ return MP_as_clip_pec_basesperhash;}
 	YY_BREAK
 case 120:
 #line 219 "parameters_flexer.ll"
 case 121:
 YY_RULE_SETUP
 #line 219 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_sxaggcxg;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_proposeendclips;}
 	YY_BREAK
 case 122:
-YY_RULE_SETUP
-#line 220 "parameters_flexer.ll"
-{ return MP_as_clip_pec_ffreq;}
-	YY_BREAK
+#line 221 "parameters_flexer.ll"
 case 123:
 YY_RULE_SETUP
 #line 221 "parameters_flexer.ll"
-{ return MP_as_clip_pec_bfreq;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_sxaggcxg;}
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 222 "parameters_flexer.ll"
-{ return MP_as_clip_pec_mkfr;}
+{ return MP_as_clip_pec_ffreq;}
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 223 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_ffr;}
+{ return MP_as_clip_pec_bfreq;}
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 224 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bfr;}
+{ return MP_as_clip_pec_mkfr;}
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 225 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_fcmst;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_ffr;}
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 226 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bcmst;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bfr;}
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 227 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_fsalp;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_fcmst;}
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 228 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bsalp;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bcmst;}
 	YY_BREAK
 case 131:
-#line 230 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 229 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_fsalp;}
+	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 230 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_skimchimeradetection;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_pec_bsalp;}
 	YY_BREAK
 case 133:
 #line 232 "parameters_flexer.ll"
 case 134:
 YY_RULE_SETUP
 #line 232 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_skimjunkdetection;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_skimchimeradetection;}
 	YY_BREAK
 case 135:
 #line 234 "parameters_flexer.ll"
 case 136:
 YY_RULE_SETUP
 #line 234 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_badsolexaends;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_skimjunkdetection;}
 	YY_BREAK
 case 137:
 #line 236 "parameters_flexer.ll"
 case 138:
 YY_RULE_SETUP
 #line 236 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_search_phix174;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_badsolexaends;}
 	YY_BREAK
 case 139:
 #line 238 "parameters_flexer.ll"
 case 140:
 YY_RULE_SETUP
 #line 238 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_filter_phix174;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_search_phix174;}
 	YY_BREAK
 case 141:
 #line 240 "parameters_flexer.ll"
 case 142:
 YY_RULE_SETUP
 #line 240 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_clip_knownadaptorsright;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_filter_phix174;}
 	YY_BREAK
 case 143:
 #line 242 "parameters_flexer.ll"
 case 144:
 YY_RULE_SETUP
 #line 242 "parameters_flexer.ll"
-{ return MP_as_clipmask_rarekmers;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_clip_knownadaptorsright;}
 	YY_BREAK
 case 145:
-#line 248 "parameters_flexer.ll"
+#line 244 "parameters_flexer.ll"
 case 146:
 YY_RULE_SETUP
-#line 248 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_savesimplesingletsinproject;}
+#line 244 "parameters_flexer.ll"
+{ return MP_as_clipmask_rarekmers;}
 	YY_BREAK
 case 147:
 #line 250 "parameters_flexer.ll"
@@ -5449,255 +6301,249 @@ case 149:
 case 150:
 YY_RULE_SETUP
 #line 252 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_removerollovertmps;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_savesimplesingletsinproject;}
 	YY_BREAK
 case 151:
 #line 254 "parameters_flexer.ll"
 case 152:
 YY_RULE_SETUP
 #line 254 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_removetmpdir;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_removerollovertmps;}
 	YY_BREAK
 case 153:
-#line 257 "parameters_flexer.ll"
+#line 256 "parameters_flexer.ll"
 case 154:
 YY_RULE_SETUP
-#line 257 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_html;}
+#line 256 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_removetmpdir;}
 	YY_BREAK
 case 155:
 #line 259 "parameters_flexer.ll"
 case 156:
 YY_RULE_SETUP
 #line 259 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_text;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_html;}
 	YY_BREAK
 case 157:
 #line 261 "parameters_flexer.ll"
 case 158:
 YY_RULE_SETUP
 #line 261 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_tcs;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_text;}
 	YY_BREAK
 case 159:
 #line 263 "parameters_flexer.ll"
 case 160:
 YY_RULE_SETUP
 #line 263 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_caf;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_tcs;}
 	YY_BREAK
 case 161:
 #line 265 "parameters_flexer.ll"
 case 162:
 YY_RULE_SETUP
 #line 265 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_maf;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_caf;}
 	YY_BREAK
 case 163:
 #line 267 "parameters_flexer.ll"
 case 164:
 YY_RULE_SETUP
 #line 267 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_ace;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_maf;}
 	YY_BREAK
 case 165:
 #line 269 "parameters_flexer.ll"
 case 166:
 YY_RULE_SETUP
 #line 269 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_gap4da;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_ace;}
 	YY_BREAK
 case 167:
 #line 271 "parameters_flexer.ll"
 case 168:
 YY_RULE_SETUP
 #line 271 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_fasta;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_gap4da;}
 	YY_BREAK
 case 169:
-#line 274 "parameters_flexer.ll"
+#line 273 "parameters_flexer.ll"
 case 170:
 YY_RULE_SETUP
-#line 274 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_alsosinglets;}
+#line 273 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tmp_fasta;}
 	YY_BREAK
 case 171:
 #line 276 "parameters_flexer.ll"
 case 172:
 YY_RULE_SETUP
 #line 276 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_html;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_alsosinglets;}
 	YY_BREAK
 case 173:
 #line 278 "parameters_flexer.ll"
 case 174:
 YY_RULE_SETUP
 #line 278 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_caf;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_html;}
 	YY_BREAK
 case 175:
 #line 280 "parameters_flexer.ll"
 case 176:
 YY_RULE_SETUP
 #line 280 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_ace;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_caf;}
 	YY_BREAK
 case 177:
 #line 282 "parameters_flexer.ll"
 case 178:
 YY_RULE_SETUP
 #line 282 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_gap4da;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_ace;}
 	YY_BREAK
 case 179:
 #line 284 "parameters_flexer.ll"
 case 180:
 YY_RULE_SETUP
 #line 284 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_fasta;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_gap4da;}
 	YY_BREAK
 case 181:
-#line 287 "parameters_flexer.ll"
+#line 286 "parameters_flexer.ll"
 case 182:
 YY_RULE_SETUP
-#line 287 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_caf;}
+#line 286 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_exttmp_fasta;}
 	YY_BREAK
 case 183:
 #line 289 "parameters_flexer.ll"
 case 184:
 YY_RULE_SETUP
 #line 289 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_maf;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_caf;}
 	YY_BREAK
 case 185:
 #line 291 "parameters_flexer.ll"
 case 186:
 YY_RULE_SETUP
 #line 291 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_html;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_maf;}
 	YY_BREAK
 case 187:
 #line 293 "parameters_flexer.ll"
 case 188:
 YY_RULE_SETUP
 #line 293 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_text;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_html;}
 	YY_BREAK
 case 189:
 #line 295 "parameters_flexer.ll"
 case 190:
 YY_RULE_SETUP
 #line 295 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_ace;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_text;}
 	YY_BREAK
 case 191:
 #line 297 "parameters_flexer.ll"
 case 192:
 YY_RULE_SETUP
 #line 297 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_wiggle;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_ace;}
 	YY_BREAK
 case 193:
 #line 299 "parameters_flexer.ll"
 case 194:
 YY_RULE_SETUP
 #line 299 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_tcs;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_wiggle;}
 	YY_BREAK
 case 195:
 #line 301 "parameters_flexer.ll"
 case 196:
 YY_RULE_SETUP
 #line 301 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_gff3;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_tcs;}
 	YY_BREAK
 case 197:
 #line 303 "parameters_flexer.ll"
 case 198:
 YY_RULE_SETUP
 #line 303 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_gap4da;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_gff3;}
 	YY_BREAK
 case 199:
 #line 305 "parameters_flexer.ll"
 case 200:
 YY_RULE_SETUP
 #line 305 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_output_fasta;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_gap4da;}
 	YY_BREAK
 case 201:
-#line 308 "parameters_flexer.ll"
+#line 307 "parameters_flexer.ll"
 case 202:
 YY_RULE_SETUP
-#line 308 "parameters_flexer.ll"
-{ return MP_con_output_html_cpl;}
+#line 307 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_fasta;}
 	YY_BREAK
 case 203:
-#line 310 "parameters_flexer.ll"
+#line 309 "parameters_flexer.ll"
 case 204:
 YY_RULE_SETUP
-#line 310 "parameters_flexer.ll"
-{ return MP_con_output_text_cpl;}
+#line 309 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_output_scaffolds;}
 	YY_BREAK
 case 205:
 #line 312 "parameters_flexer.ll"
 case 206:
 YY_RULE_SETUP
 #line 312 "parameters_flexer.ll"
-{ singlechar_id=MP_con_output_html_gapfill; yy_push_state(GET_SINGLECHAR_STRING_MODE);}
+{ return MP_con_output_html_cpl;}
 	YY_BREAK
 case 207:
 #line 314 "parameters_flexer.ll"
 case 208:
 YY_RULE_SETUP
 #line 314 "parameters_flexer.ll"
-{ singlechar_id=MP_con_output_text_gapfill;yy_push_state(GET_SINGLECHAR_STRING_MODE);}
+{ return MP_con_output_text_cpl;}
 	YY_BREAK
 case 209:
-YY_RULE_SETUP
 #line 316 "parameters_flexer.ll"
-
-	YY_BREAK
 case 210:
 YY_RULE_SETUP
-#line 317 "parameters_flexer.ll"
-{yy_pop_state(); return singlechar_id;}
+#line 316 "parameters_flexer.ll"
+{ singlechar_id=MP_con_output_html_gapfill; yy_push_state(GET_SINGLECHAR_STRING_MODE);}
 	YY_BREAK
 case 211:
-YY_RULE_SETUP
 #line 318 "parameters_flexer.ll"
-{yy_pop_state(); return singlechar_id;}
-	YY_BREAK
 case 212:
 YY_RULE_SETUP
-#line 319 "parameters_flexer.ll"
-
+#line 318 "parameters_flexer.ll"
+{ singlechar_id=MP_con_output_text_gapfill;yy_push_state(GET_SINGLECHAR_STRING_MODE);}
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 320 "parameters_flexer.ll"
-{yy_pop_state(); return singlechar_id;}
+
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
-#line 323 "parameters_flexer.ll"
-{yy_pop_state(); return 1;}
+#line 321 "parameters_flexer.ll"
+{yy_pop_state(); return singlechar_id;}
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
-#line 324 "parameters_flexer.ll"
-{yy_pop_state(); return 0;}
+#line 322 "parameters_flexer.ll"
+{yy_pop_state(); return singlechar_id;}
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
-#line 325 "parameters_flexer.ll"
-{yy_pop_state(); return 1;}
+#line 323 "parameters_flexer.ll"
+
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
-#line 326 "parameters_flexer.ll"
-{yy_pop_state(); return 0;}
+#line 324 "parameters_flexer.ll"
+{yy_pop_state(); return singlechar_id;}
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
@@ -5722,360 +6568,366 @@ YY_RULE_SETUP
 case 222:
 YY_RULE_SETUP
 #line 331 "parameters_flexer.ll"
-{}
+{yy_pop_state(); return 1;}
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 332 "parameters_flexer.ll"
-{yy_pop_state(); return MP_UNRECOGNISED_STRING;}
+{yy_pop_state(); return 0;}
 	YY_BREAK
 case 224:
-#line 335 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 333 "parameters_flexer.ll"
+{yy_pop_state(); return 1;}
+	YY_BREAK
 case 225:
 YY_RULE_SETUP
-#line 335 "parameters_flexer.ll"
-{filenameid=MP_dir_tmp_redirectedto; yy_push_state(FN_MODE); }
+#line 334 "parameters_flexer.ll"
+{yy_pop_state(); return 0;}
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 336 "parameters_flexer.ll"
-{filenameid=MP_dir_tmp; yy_push_state(FN_MODE); }
+#line 335 "parameters_flexer.ll"
+{}
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
-#line 338 "parameters_flexer.ll"
-{ yy_pop_state(); return filenameid;}
+#line 336 "parameters_flexer.ll"
+{yy_pop_state(); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 228:
-#line 342 "parameters_flexer.ll"
+#line 339 "parameters_flexer.ll"
 case 229:
 YY_RULE_SETUP
-#line 342 "parameters_flexer.ll"
-{ return MP_as_minimum_readlength;}
+#line 339 "parameters_flexer.ll"
+{filenameid=MP_dir_tmp_redirectedto; yy_push_state(FN_MODE); }
 	YY_BREAK
 case 230:
-#line 344 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 340 "parameters_flexer.ll"
+{filenameid=MP_dir_tmp; yy_push_state(FN_MODE); }
+	YY_BREAK
 case 231:
 YY_RULE_SETUP
-#line 344 "parameters_flexer.ll"
-{ return MP_as_minimum_readspercontig;}
+#line 342 "parameters_flexer.ll"
+{ yy_pop_state(); return filenameid;}
 	YY_BREAK
 case 232:
 #line 346 "parameters_flexer.ll"
 case 233:
 YY_RULE_SETUP
 #line 346 "parameters_flexer.ll"
-{ return(MP_as_numpasses);}
+{ return MP_as_minimum_readlength;}
 	YY_BREAK
 case 234:
 #line 348 "parameters_flexer.ll"
 case 235:
 YY_RULE_SETUP
 #line 348 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return(MP_as_skimeachpass);}
+{ return MP_as_minimum_readspercontig;}
 	YY_BREAK
 case 236:
 #line 350 "parameters_flexer.ll"
 case 237:
 YY_RULE_SETUP
 #line 350 "parameters_flexer.ll"
-{ return MP_as_numrmbbreakloops;}
+{ return(MP_as_numpasses);}
 	YY_BREAK
 case 238:
 #line 352 "parameters_flexer.ll"
 case 239:
 YY_RULE_SETUP
 #line 352 "parameters_flexer.ll"
-{ return MP_as_maxcontigsperpass;}
+{ yy_push_state(ASK_YN_MODE); return(MP_as_skimeachpass);}
 	YY_BREAK
 case 240:
 #line 354 "parameters_flexer.ll"
 case 241:
 YY_RULE_SETUP
 #line 354 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_spoiler_detection;}
+{ return MP_as_numrmbbreakloops;}
 	YY_BREAK
 case 242:
 #line 356 "parameters_flexer.ll"
 case 243:
 YY_RULE_SETUP
 #line 356 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_sd_lastpassonly;}
+{ return MP_as_maxcontigsperpass;}
 	YY_BREAK
 case 244:
 #line 358 "parameters_flexer.ll"
 case 245:
 YY_RULE_SETUP
 #line 358 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_automatic_repeat_detection;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_spoiler_detection;}
 	YY_BREAK
 case 246:
 #line 360 "parameters_flexer.ll"
 case 247:
 YY_RULE_SETUP
 #line 360 "parameters_flexer.ll"
-{ return MP_as_ard_multicopythreshold;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_sd_lastpassonly;}
 	YY_BREAK
 case 248:
 #line 362 "parameters_flexer.ll"
 case 249:
 YY_RULE_SETUP
 #line 362 "parameters_flexer.ll"
-{ return MP_as_ard_multicopyminlen;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_automatic_repeat_detection;}
 	YY_BREAK
 case 250:
 #line 364 "parameters_flexer.ll"
 case 251:
 YY_RULE_SETUP
 #line 364 "parameters_flexer.ll"
-{ return MP_as_ard_multicopygrace;}
+{ return MP_as_ard_multicopythreshold;}
 	YY_BREAK
 case 252:
 #line 366 "parameters_flexer.ll"
 case 253:
 YY_RULE_SETUP
 #line 366 "parameters_flexer.ll"
-{ return MP_as_urd_cutoffmultiplier;}
+{ return MP_as_ard_multicopyminlen;}
 	YY_BREAK
 case 254:
 #line 368 "parameters_flexer.ll"
 case 255:
 YY_RULE_SETUP
 #line 368 "parameters_flexer.ll"
-{ return MP_as_urd_startinpass;}
+{ return MP_as_ard_multicopygrace;}
 	YY_BREAK
 case 256:
 #line 370 "parameters_flexer.ll"
 case 257:
 YY_RULE_SETUP
 #line 370 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_uniform_read_distribution;}
+{ return MP_as_urd_cutoffmultiplier;}
 	YY_BREAK
 case 258:
 #line 372 "parameters_flexer.ll"
 case 259:
 YY_RULE_SETUP
 #line 372 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_paf_use_genomic_pathfinder;}
+{ return MP_as_urd_startinpass;}
 	YY_BREAK
 case 260:
 #line 374 "parameters_flexer.ll"
 case 261:
 YY_RULE_SETUP
 #line 374 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_paf_use_emergency_search_stop;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_uniform_read_distribution;}
 	YY_BREAK
 case 262:
 #line 376 "parameters_flexer.ll"
 case 263:
 YY_RULE_SETUP
 #line 376 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_paf_use_emergency_blacklist;}
+{ yy_push_state(ASK_YN_MODE); return MP_paf_use_genomic_pathfinder;}
 	YY_BREAK
 case 264:
 #line 378 "parameters_flexer.ll"
 case 265:
 YY_RULE_SETUP
 #line 378 "parameters_flexer.ll"
-{return MP_paf_ess_partnerdepth;}
+{ yy_push_state(ASK_YN_MODE); return MP_paf_use_emergency_search_stop;}
 	YY_BREAK
 case 266:
 #line 380 "parameters_flexer.ll"
 case 267:
 YY_RULE_SETUP
 #line 380 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_paf_use_max_contig_buildtime;}
+{ yy_push_state(ASK_YN_MODE); return MP_paf_use_emergency_blacklist;}
 	YY_BREAK
 case 268:
 #line 382 "parameters_flexer.ll"
 case 269:
 YY_RULE_SETUP
 #line 382 "parameters_flexer.ll"
-{return MP_paf_buildtime_inseconds;}
+{return MP_paf_ess_partnerdepth;}
 	YY_BREAK
 case 270:
 #line 384 "parameters_flexer.ll"
 case 271:
 YY_RULE_SETUP
 #line 384 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_as_enforce_qualsinreads;}
+{yy_push_state(ASK_YN_MODE); return MP_paf_use_max_contig_buildtime;}
 	YY_BREAK
 case 272:
-#line 388 "parameters_flexer.ll"
+#line 386 "parameters_flexer.ll"
 case 273:
 YY_RULE_SETUP
-#line 388 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_extend_reads;}
+#line 386 "parameters_flexer.ll"
+{return MP_paf_buildtime_inseconds;}
 	YY_BREAK
 case 274:
-#line 390 "parameters_flexer.ll"
+#line 388 "parameters_flexer.ll"
 case 275:
 YY_RULE_SETUP
-#line 390 "parameters_flexer.ll"
-{return MP_as_readextension_window_len;}
+#line 388 "parameters_flexer.ll"
+{yy_push_state(ASK_YN_MODE); return MP_as_enforce_qualsinreads;}
 	YY_BREAK
 case 276:
 #line 392 "parameters_flexer.ll"
 case 277:
 YY_RULE_SETUP
 #line 392 "parameters_flexer.ll"
-{return MP_as_readextension_window_maxerrors;}
+{ yy_push_state(ASK_YN_MODE); return MP_as_extend_reads;}
 	YY_BREAK
 case 278:
 #line 394 "parameters_flexer.ll"
 case 279:
 YY_RULE_SETUP
 #line 394 "parameters_flexer.ll"
-{return MP_as_readextension_firstpassnum;}
+{return MP_as_readextension_window_len;}
 	YY_BREAK
 case 280:
 #line 396 "parameters_flexer.ll"
 case 281:
 YY_RULE_SETUP
 #line 396 "parameters_flexer.ll"
-{return MP_as_readextension_lastpassnum;}
+{return MP_as_readextension_window_maxerrors;}
 	YY_BREAK
 case 282:
-#line 400 "parameters_flexer.ll"
+#line 398 "parameters_flexer.ll"
 case 283:
 YY_RULE_SETUP
-#line 400 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ed_mira_automatic_contig_editing;}
+#line 398 "parameters_flexer.ll"
+{return MP_as_readextension_firstpassnum;}
 	YY_BREAK
 case 284:
-YY_RULE_SETUP
-#line 401 "parameters_flexer.ll"
-
-	YY_BREAK
+#line 400 "parameters_flexer.ll"
 case 285:
 YY_RULE_SETUP
-#line 402 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ed_kmer_singlets;}
+#line 400 "parameters_flexer.ll"
+{return MP_as_readextension_lastpassnum;}
 	YY_BREAK
 case 286:
-YY_RULE_SETUP
-#line 403 "parameters_flexer.ll"
-
-	YY_BREAK
+#line 404 "parameters_flexer.ll"
 case 287:
 YY_RULE_SETUP
 #line 404 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ed_homopolymer_overcalls;}
+{ yy_push_state(ASK_YN_MODE); return MP_ed_mira_automatic_contig_editing;}
 	YY_BREAK
 case 288:
-#line 407 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 405 "parameters_flexer.ll"
+
+	YY_BREAK
 case 289:
 YY_RULE_SETUP
-#line 407 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ed_edit_automatic_contig_editing;}
+#line 406 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_ed_kmer_singlets;}
 	YY_BREAK
 case 290:
-#line 409 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 407 "parameters_flexer.ll"
+
+	YY_BREAK
 case 291:
 YY_RULE_SETUP
-#line 409 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ed_strict;}
+#line 408 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_ed_homopolymer_overcalls;}
 	YY_BREAK
 case 292:
 #line 411 "parameters_flexer.ll"
 case 293:
 YY_RULE_SETUP
 #line 411 "parameters_flexer.ll"
-{ return MP_ed_confirmation_threshold;}
+{ yy_push_state(ASK_YN_MODE); return MP_ed_edit_automatic_contig_editing;}
 	YY_BREAK
 case 294:
-#line 414 "parameters_flexer.ll"
+#line 413 "parameters_flexer.ll"
 case 295:
 YY_RULE_SETUP
-#line 414 "parameters_flexer.ll"
-{return MP_sk_numthreads;}
+#line 413 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_ed_strict;}
 	YY_BREAK
 case 296:
-YY_RULE_SETUP
 #line 415 "parameters_flexer.ll"
-{return MP_sk_bph_increasestep;}
-	YY_BREAK
 case 297:
 YY_RULE_SETUP
-#line 416 "parameters_flexer.ll"
-{return MP_sk_bph_coveragethreshold;}
+#line 415 "parameters_flexer.ll"
+{ return MP_ed_confirmation_threshold;}
 	YY_BREAK
 case 298:
 #line 418 "parameters_flexer.ll"
 case 299:
 YY_RULE_SETUP
 #line 418 "parameters_flexer.ll"
-{return MP_sk_basesperhash;}
+{return MP_sk_numthreads;}
 	YY_BREAK
 case 300:
-#line 420 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 419 "parameters_flexer.ll"
+{return MP_sk_bph_increasestep;}
+	YY_BREAK
 case 301:
 YY_RULE_SETUP
 #line 420 "parameters_flexer.ll"
-{return MP_sk_hashsavestepping;}
+{return MP_sk_bph_coveragethreshold;}
 	YY_BREAK
 case 302:
 #line 422 "parameters_flexer.ll"
 case 303:
 YY_RULE_SETUP
 #line 422 "parameters_flexer.ll"
-{return MP_sk_percentrequired;}
+{return MP_sk_basesperhash;}
 	YY_BREAK
 case 304:
 #line 424 "parameters_flexer.ll"
 case 305:
 YY_RULE_SETUP
 #line 424 "parameters_flexer.ll"
-{return MP_sk_maxhitsperread;}
+{return MP_sk_hashsavestepping;}
 	YY_BREAK
 case 306:
 #line 426 "parameters_flexer.ll"
 case 307:
 YY_RULE_SETUP
 #line 426 "parameters_flexer.ll"
-{return MP_sk_maxhashesinmemory;}
+{return MP_sk_percentrequired;}
 	YY_BREAK
 case 308:
 #line 428 "parameters_flexer.ll"
 case 309:
 YY_RULE_SETUP
 #line 428 "parameters_flexer.ll"
-{return MP_sk_memcaphitreduction;}
+{return MP_sk_maxhitsperread;}
 	YY_BREAK
 case 310:
 #line 430 "parameters_flexer.ll"
 case 311:
 YY_RULE_SETUP
 #line 430 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_sk_alsoskimrevcomp;}
+{return MP_sk_maxhashesinmemory;}
 	YY_BREAK
 case 312:
 #line 432 "parameters_flexer.ll"
 case 313:
 YY_RULE_SETUP
 #line 432 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_sk_swcheckonbackbones;}
+{return MP_sk_memcaphitreduction;}
 	YY_BREAK
 case 314:
 #line 434 "parameters_flexer.ll"
 case 315:
 YY_RULE_SETUP
 #line 434 "parameters_flexer.ll"
-{return MP_sk_maxmegahubratio;}
+{yy_push_state(ASK_YN_MODE); return MP_sk_alsoskimrevcomp;}
 	YY_BREAK
 case 316:
-#line 437 "parameters_flexer.ll"
+#line 436 "parameters_flexer.ll"
 case 317:
 YY_RULE_SETUP
-#line 437 "parameters_flexer.ll"
-{return MP_ERROR_MOVED_SECTION_HS;}
+#line 436 "parameters_flexer.ll"
+{yy_push_state(ASK_YN_MODE); return MP_sk_swcheckonbackbones;}
 	YY_BREAK
 case 318:
-#line 439 "parameters_flexer.ll"
+#line 438 "parameters_flexer.ll"
 case 319:
 YY_RULE_SETUP
-#line 439 "parameters_flexer.ll"
-{return MP_ERROR_MOVED_SECTION_HS;}
+#line 438 "parameters_flexer.ll"
+{return MP_sk_maxmegahubratio;}
 	YY_BREAK
 case 320:
 #line 441 "parameters_flexer.ll"
@@ -6089,7 +6941,7 @@ case 322:
 case 323:
 YY_RULE_SETUP
 #line 443 "parameters_flexer.ll"
-{ return MP_ERROR_MOVED_SECTION_HS;}
+{return MP_ERROR_MOVED_SECTION_HS;}
 	YY_BREAK
 case 324:
 #line 445 "parameters_flexer.ll"
@@ -6103,7 +6955,7 @@ case 326:
 case 327:
 YY_RULE_SETUP
 #line 447 "parameters_flexer.ll"
-{return MP_ERROR_MOVED_SECTION_HS;}
+{ return MP_ERROR_MOVED_SECTION_HS;}
 	YY_BREAK
 case 328:
 #line 449 "parameters_flexer.ll"
@@ -6134,681 +6986,684 @@ YY_RULE_SETUP
 {return MP_ERROR_MOVED_SECTION_HS;}
 	YY_BREAK
 case 336:
-#line 459 "parameters_flexer.ll"
+#line 457 "parameters_flexer.ll"
 case 337:
 YY_RULE_SETUP
-#line 459 "parameters_flexer.ll"
-{return MP_hs_nastyrepeatratio;}
+#line 457 "parameters_flexer.ll"
+{return MP_ERROR_MOVED_SECTION_HS;}
 	YY_BREAK
 case 338:
-#line 461 "parameters_flexer.ll"
+#line 459 "parameters_flexer.ll"
 case 339:
 YY_RULE_SETUP
-#line 461 "parameters_flexer.ll"
-{return MP_hs_nastyrepeatcoverage;}
+#line 459 "parameters_flexer.ll"
+{return MP_ERROR_MOVED_SECTION_HS;}
 	YY_BREAK
 case 340:
 #line 463 "parameters_flexer.ll"
 case 341:
 YY_RULE_SETUP
 #line 463 "parameters_flexer.ll"
-{return MP_hs_repeatlevel_in_infofile;}
+{return MP_hs_nastyrepeatratio;}
 	YY_BREAK
 case 342:
 #line 465 "parameters_flexer.ll"
 case 343:
 YY_RULE_SETUP
 #line 465 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_hs_masknastyrepeats;}
+{return MP_hs_nastyrepeatcoverage;}
 	YY_BREAK
 case 344:
 #line 467 "parameters_flexer.ll"
 case 345:
 YY_RULE_SETUP
 #line 467 "parameters_flexer.ll"
-{return MP_hs_freq_covestmin;}
+{return MP_hs_repeatlevel_in_infofile;}
 	YY_BREAK
 case 346:
 #line 469 "parameters_flexer.ll"
 case 347:
 YY_RULE_SETUP
 #line 469 "parameters_flexer.ll"
-{return MP_hs_freqest_minnormal;}
+{yy_push_state(ASK_YN_MODE); return MP_hs_masknastyrepeats;}
 	YY_BREAK
 case 348:
 #line 471 "parameters_flexer.ll"
 case 349:
 YY_RULE_SETUP
 #line 471 "parameters_flexer.ll"
-{return MP_hs_freqest_maxnormal;}
+{return MP_hs_freq_covestmin;}
 	YY_BREAK
 case 350:
 #line 473 "parameters_flexer.ll"
 case 351:
 YY_RULE_SETUP
 #line 473 "parameters_flexer.ll"
-{return MP_hs_freqest_repeat;}
+{return MP_hs_freqest_minnormal;}
 	YY_BREAK
 case 352:
 #line 475 "parameters_flexer.ll"
 case 353:
 YY_RULE_SETUP
 #line 475 "parameters_flexer.ll"
-{return MP_hs_freqest_heavyrepeat;}
+{return MP_hs_freqest_maxnormal;}
 	YY_BREAK
 case 354:
 #line 477 "parameters_flexer.ll"
 case 355:
 YY_RULE_SETUP
 #line 477 "parameters_flexer.ll"
-{return MP_hs_freqest_crazyrepeat;}
+{return MP_hs_freqest_repeat;}
 	YY_BREAK
 case 356:
 #line 479 "parameters_flexer.ll"
 case 357:
 YY_RULE_SETUP
 #line 479 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_hs_applydigitalnormalisation;}
+{return MP_hs_freqest_heavyrepeat;}
 	YY_BREAK
 case 358:
 #line 481 "parameters_flexer.ll"
 case 359:
 YY_RULE_SETUP
 #line 481 "parameters_flexer.ll"
-{yy_push_state(ASK_YN_MODE); return MP_hs_rare_kmer_early_kill;}
+{return MP_hs_freqest_crazyrepeat;}
 	YY_BREAK
 case 360:
 #line 483 "parameters_flexer.ll"
 case 361:
 YY_RULE_SETUP
 #line 483 "parameters_flexer.ll"
-{return MP_hs_million_hashes_per_buffer;}
+{yy_push_state(ASK_YN_MODE); return MP_hs_applydigitalnormalisation;}
 	YY_BREAK
 case 362:
-#line 488 "parameters_flexer.ll"
+#line 485 "parameters_flexer.ll"
 case 363:
 YY_RULE_SETUP
-#line 488 "parameters_flexer.ll"
-{return MP_al_bip;}
+#line 485 "parameters_flexer.ll"
+{yy_push_state(ASK_YN_MODE); return MP_hs_rare_kmer_early_kill;}
 	YY_BREAK
 case 364:
-#line 490 "parameters_flexer.ll"
+#line 487 "parameters_flexer.ll"
 case 365:
 YY_RULE_SETUP
-#line 490 "parameters_flexer.ll"
-{return MP_al_bmax;}
+#line 487 "parameters_flexer.ll"
+{return MP_hs_million_hashes_per_buffer;}
 	YY_BREAK
 case 366:
 #line 492 "parameters_flexer.ll"
 case 367:
 YY_RULE_SETUP
 #line 492 "parameters_flexer.ll"
-{return MP_al_bmin;}
+{return MP_al_bip;}
 	YY_BREAK
 case 368:
 #line 494 "parameters_flexer.ll"
 case 369:
 YY_RULE_SETUP
 #line 494 "parameters_flexer.ll"
-{return MP_al_min_score;}
+{return MP_al_bmax;}
 	YY_BREAK
 case 370:
 #line 496 "parameters_flexer.ll"
 case 371:
 YY_RULE_SETUP
 #line 496 "parameters_flexer.ll"
-{return MP_al_min_overlap;}
+{return MP_al_bmin;}
 	YY_BREAK
 case 372:
 #line 498 "parameters_flexer.ll"
 case 373:
 YY_RULE_SETUP
 #line 498 "parameters_flexer.ll"
-{return MP_al_min_relscore;}
+{return MP_al_min_score;}
 	YY_BREAK
 case 374:
 #line 500 "parameters_flexer.ll"
 case 375:
 YY_RULE_SETUP
 #line 500 "parameters_flexer.ll"
-{BEGIN(AL_GPLMODE); return MP_ads_gp_level;}
+{return MP_al_min_overlap;}
 	YY_BREAK
 case 376:
 #line 502 "parameters_flexer.ll"
 case 377:
 YY_RULE_SETUP
 #line 502 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_ads_extra_gap_penalty;}
+{return MP_al_min_relscore;}
 	YY_BREAK
 case 378:
 #line 504 "parameters_flexer.ll"
 case 379:
 YY_RULE_SETUP
 #line 504 "parameters_flexer.ll"
-{return MP_ads_max_gppercent;}
+{BEGIN(AL_GPLMODE); return MP_ads_gp_level;}
 	YY_BREAK
 case 380:
 #line 506 "parameters_flexer.ll"
 case 381:
 YY_RULE_SETUP
 #line 506 "parameters_flexer.ll"
-{return MP_al_solexahack_maxerrors;}
+{ yy_push_state(ASK_YN_MODE); return MP_ads_extra_gap_penalty;}
 	YY_BREAK
 case 382:
 #line 508 "parameters_flexer.ll"
 case 383:
 YY_RULE_SETUP
 #line 508 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return 10;}
+{return MP_ads_max_gppercent;}
 	YY_BREAK
 case 384:
 #line 510 "parameters_flexer.ll"
 case 385:
 YY_RULE_SETUP
 #line 510 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return 0;}
+{return MP_al_solexahack_maxerrors;}
 	YY_BREAK
 case 386:
 #line 512 "parameters_flexer.ll"
 case 387:
 YY_RULE_SETUP
 #line 512 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return 1;}
+{BEGIN(ALIGN_MODE); return 10;}
 	YY_BREAK
 case 388:
 #line 514 "parameters_flexer.ll"
 case 389:
 YY_RULE_SETUP
 #line 514 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return 2;}
+{BEGIN(ALIGN_MODE); return 0;}
 	YY_BREAK
 case 390:
-YY_RULE_SETUP
-#line 515 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
-	YY_BREAK
+#line 516 "parameters_flexer.ll"
 case 391:
 YY_RULE_SETUP
 #line 516 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(ALIGN_MODE); return 1;}
 	YY_BREAK
 case 392:
-YY_RULE_SETUP
-#line 517 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
-	YY_BREAK
+#line 518 "parameters_flexer.ll"
 case 393:
-/* rule 393 can match eol */
 YY_RULE_SETUP
 #line 518 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(ALIGN_MODE); return 2;}
 	YY_BREAK
 case 394:
-#line 521 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 519 "parameters_flexer.ll"
+{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
+	YY_BREAK
 case 395:
 YY_RULE_SETUP
-#line 521 "parameters_flexer.ll"
-{BEGIN(CO_VALMODE); return MP_con_analyse_mode;}
+#line 520 "parameters_flexer.ll"
+{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 396:
 YY_RULE_SETUP
-#line 522 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return 0;}
+#line 521 "parameters_flexer.ll"
+{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 397:
+/* rule 397 can match eol */
 YY_RULE_SETUP
-#line 523 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return 1;}
+#line 522 "parameters_flexer.ll"
+{BEGIN(ALIGN_MODE); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 398:
-YY_RULE_SETUP
-#line 524 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return 2;}
-	YY_BREAK
+#line 525 "parameters_flexer.ll"
 case 399:
 YY_RULE_SETUP
 #line 525 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(CO_VALMODE); return MP_con_analyse_mode;}
 	YY_BREAK
 case 400:
 YY_RULE_SETUP
 #line 526 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(CO_MODE); return 0;}
 	YY_BREAK
 case 401:
 YY_RULE_SETUP
 #line 527 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(CO_MODE); return 1;}
 	YY_BREAK
 case 402:
-/* rule 402 can match eol */
 YY_RULE_SETUP
 #line 528 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+{BEGIN(CO_MODE); return 2;}
 	YY_BREAK
 case 403:
-#line 530 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 529 "parameters_flexer.ll"
+{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+	YY_BREAK
 case 404:
 YY_RULE_SETUP
 #line 530 "parameters_flexer.ll"
-{return MP_con_rodirs;}
+{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 405:
-#line 532 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 531 "parameters_flexer.ll"
+{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
+	YY_BREAK
 case 406:
+/* rule 406 can match eol */
 YY_RULE_SETUP
 #line 532 "parameters_flexer.ll"
-{return MP_con_danger_max_error_rate;}
+{BEGIN(CO_MODE); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 407:
 #line 534 "parameters_flexer.ll"
 case 408:
 YY_RULE_SETUP
 #line 534 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_mark_repeats;}
+{return MP_con_rodirs;}
 	YY_BREAK
 case 409:
 #line 536 "parameters_flexer.ll"
 case 410:
-#line 537 "parameters_flexer.ll"
-case 411:
 YY_RULE_SETUP
-#line 537 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_as_mark_repeats_only_in_result;}
+#line 536 "parameters_flexer.ll"
+{return MP_con_danger_max_error_rate;}
 	YY_BREAK
+case 411:
+#line 538 "parameters_flexer.ll"
 case 412:
-#line 539 "parameters_flexer.ll"
-case 413:
 YY_RULE_SETUP
-#line 539 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_assume_snp_insteadof_rmb;}
+#line 538 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_mark_repeats;}
 	YY_BREAK
+case 413:
+#line 540 "parameters_flexer.ll"
 case 414:
 #line 541 "parameters_flexer.ll"
 case 415:
-#line 542 "parameters_flexer.ll"
-case 416:
 YY_RULE_SETUP
-#line 542 "parameters_flexer.ll"
-{return MP_con_min_rmb_neighbourqual;}
+#line 541 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_as_mark_repeats_only_in_result;}
 	YY_BREAK
+case 416:
+#line 543 "parameters_flexer.ll"
 case 417:
-#line 544 "parameters_flexer.ll"
-case 418:
 YY_RULE_SETUP
-#line 544 "parameters_flexer.ll"
-{return MP_con_min_readspergroup;}
+#line 543 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_con_assume_snp_insteadof_rmb;}
 	YY_BREAK
+case 418:
+#line 545 "parameters_flexer.ll"
 case 419:
 #line 546 "parameters_flexer.ll"
 case 420:
 YY_RULE_SETUP
 #line 546 "parameters_flexer.ll"
-{return MP_con_min_groupqual_for_rmb_tagging;}
+{return MP_con_min_rmb_neighbourqual;}
 	YY_BREAK
 case 421:
 #line 548 "parameters_flexer.ll"
 case 422:
 YY_RULE_SETUP
 #line 548 "parameters_flexer.ll"
-{return MP_con_emea_setzero_on_clipping_pec;}
+{return MP_con_min_readspergroup;}
 	YY_BREAK
 case 423:
 #line 550 "parameters_flexer.ll"
 case 424:
 YY_RULE_SETUP
 #line 550 "parameters_flexer.ll"
-{return MP_con_endread_mark_exclusion_area;}
+{return MP_con_min_groupqual_for_rmb_tagging;}
 	YY_BREAK
 case 425:
 #line 552 "parameters_flexer.ll"
 case 426:
 YY_RULE_SETUP
 #line 552 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases_evenmc;}
+{return MP_con_emea_setzero_on_clipping_pec;}
 	YY_BREAK
 case 427:
 #line 554 "parameters_flexer.ll"
 case 428:
 YY_RULE_SETUP
 #line 554 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases_needbothstrands;}
+{return MP_con_endread_mark_exclusion_area;}
 	YY_BREAK
 case 429:
 #line 556 "parameters_flexer.ll"
 case 430:
 YY_RULE_SETUP
 #line 556 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases;}
+{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases_evenmc;}
 	YY_BREAK
 case 431:
 #line 558 "parameters_flexer.ll"
 case 432:
-#line 559 "parameters_flexer.ll"
-case 433:
 YY_RULE_SETUP
-#line 559 "parameters_flexer.ll"
-{filenameid=MP_con_name_prefix; yy_push_state(FN_MODE);}
+#line 558 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases_needbothstrands;}
 	YY_BREAK
+case 433:
+#line 560 "parameters_flexer.ll"
 case 434:
-#line 561 "parameters_flexer.ll"
-case 435:
 YY_RULE_SETUP
-#line 561 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_force_nonIUPACconsensus_perseqtype;}
+#line 560 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_con_also_mark_gap_bases;}
 	YY_BREAK
+case 435:
+#line 562 "parameters_flexer.ll"
 case 436:
 #line 563 "parameters_flexer.ll"
 case 437:
 YY_RULE_SETUP
 #line 563 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_force_nonIUPACconsensus_amongseqtypes;}
+{filenameid=MP_con_name_prefix; yy_push_state(FN_MODE);}
 	YY_BREAK
 case 438:
 #line 565 "parameters_flexer.ll"
 case 439:
 YY_RULE_SETUP
 #line 565 "parameters_flexer.ll"
-{ return MP_con_msr_maxerrors;}
+{ yy_push_state(ASK_YN_MODE); return MP_con_force_nonIUPACconsensus_perseqtype;}
 	YY_BREAK
 case 440:
 #line 567 "parameters_flexer.ll"
 case 441:
 YY_RULE_SETUP
 #line 567 "parameters_flexer.ll"
-{ return MP_con_msr_keependsunmapped;}
+{ yy_push_state(ASK_YN_MODE); return MP_con_force_nonIUPACconsensus_amongseqtypes;}
 	YY_BREAK
 case 442:
 #line 569 "parameters_flexer.ll"
 case 443:
 YY_RULE_SETUP
 #line 569 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_con_mergeshortreads;}
+{ return MP_con_msr_maxerrors;}
 	YY_BREAK
 case 444:
 #line 571 "parameters_flexer.ll"
 case 445:
 YY_RULE_SETUP
 #line 571 "parameters_flexer.ll"
-{return MP_con_gap_override_ratio;}
+{ return MP_con_msr_keependsunmapped;}
 	YY_BREAK
 case 446:
-#line 574 "parameters_flexer.ll"
+#line 573 "parameters_flexer.ll"
 case 447:
 YY_RULE_SETUP
-#line 574 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_mi_extendedlog;}
+#line 573 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_con_mergeshortreads;}
 	YY_BREAK
 case 448:
-#line 576 "parameters_flexer.ll"
+#line 575 "parameters_flexer.ll"
 case 449:
 YY_RULE_SETUP
-#line 576 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_mi_iknowwhatido;}
+#line 575 "parameters_flexer.ll"
+{return MP_con_gap_override_ratio;}
 	YY_BREAK
 case 450:
 #line 578 "parameters_flexer.ll"
 case 451:
 YY_RULE_SETUP
 #line 578 "parameters_flexer.ll"
-{ return MP_mi_as_largecontigsize4stats;}
+{ yy_push_state(ASK_YN_MODE); return MP_mi_extendedlog;}
 	YY_BREAK
 case 452:
 #line 580 "parameters_flexer.ll"
 case 453:
 YY_RULE_SETUP
 #line 580 "parameters_flexer.ll"
-{ return MP_mi_as_largecontigsize;}
+{ yy_push_state(ASK_YN_MODE); return MP_mi_iknowwhatido;}
 	YY_BREAK
 case 454:
-YY_RULE_SETUP
-#line 581 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag1;}
-	YY_BREAK
+#line 582 "parameters_flexer.ll"
 case 455:
 YY_RULE_SETUP
 #line 582 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag2;}
+{ return MP_mi_as_largecontigsize4stats;}
 	YY_BREAK
 case 456:
-YY_RULE_SETUP
-#line 583 "parameters_flexer.ll"
-{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag3;}
-	YY_BREAK
+#line 584 "parameters_flexer.ll"
 case 457:
 YY_RULE_SETUP
 #line 584 "parameters_flexer.ll"
-{ return MP_ERROR_MOVED_SECTION_NW;}
+{ return MP_mi_as_largecontigsize;}
 	YY_BREAK
 case 458:
 YY_RULE_SETUP
 #line 585 "parameters_flexer.ll"
-{ return MP_ERROR_MOVED_SECTION_NW;}
+{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag1;}
 	YY_BREAK
 case 459:
-#line 588 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 586 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag2;}
+	YY_BREAK
 case 460:
 YY_RULE_SETUP
-#line 588 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_nfs;}
+#line 587 "parameters_flexer.ll"
+{ yy_push_state(ASK_YN_MODE); return MP_mi_extra_flag3;}
 	YY_BREAK
 case 461:
-#line 590 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 588 "parameters_flexer.ll"
+{ return MP_ERROR_MOVED_SECTION_NW;}
+	YY_BREAK
 case 462:
 YY_RULE_SETUP
-#line 590 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_templateproblems;}
+#line 589 "parameters_flexer.ll"
+{ return MP_ERROR_MOVED_SECTION_NW;}
 	YY_BREAK
 case 463:
 #line 592 "parameters_flexer.ll"
 case 464:
 YY_RULE_SETUP
 #line 592 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_duplicatereadnames;}
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_nfs;}
 	YY_BREAK
 case 465:
 #line 594 "parameters_flexer.ll"
 case 466:
 YY_RULE_SETUP
 #line 594 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_maxreadnamelength;}
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_templateproblems;}
 	YY_BREAK
 case 467:
 #line 596 "parameters_flexer.ll"
 case 468:
 YY_RULE_SETUP
 #line 596 "parameters_flexer.ll"
-{ return MP_nw_check_mrnlvalue;}
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_duplicatereadnames;}
 	YY_BREAK
 case 469:
 #line 598 "parameters_flexer.ll"
 case 470:
 YY_RULE_SETUP
 #line 598 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_multipassmapping;}
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_maxreadnamelength;}
 	YY_BREAK
 case 471:
 #line 600 "parameters_flexer.ll"
 case 472:
 YY_RULE_SETUP
 #line 600 "parameters_flexer.ll"
-{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_coverage;}
+{ return MP_nw_check_mrnlvalue;}
 	YY_BREAK
 case 473:
 #line 602 "parameters_flexer.ll"
 case 474:
 YY_RULE_SETUP
 #line 602 "parameters_flexer.ll"
-{ return MP_nw_check_covvalue;}
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_multipassmapping;}
 	YY_BREAK
 case 475:
-YY_RULE_SETUP
 #line 604 "parameters_flexer.ll"
-{yy_pop_state(); return 0;}
-	YY_BREAK
 case 476:
 YY_RULE_SETUP
-#line 605 "parameters_flexer.ll"
-{yy_pop_state(); return 1;}
+#line 604 "parameters_flexer.ll"
+{ yy_push_state(NW_CHOICEMODE); return MP_nw_check_coverage;}
 	YY_BREAK
 case 477:
-YY_RULE_SETUP
 #line 606 "parameters_flexer.ll"
-{yy_pop_state(); return 2;}
-	YY_BREAK
 case 478:
 YY_RULE_SETUP
-#line 607 "parameters_flexer.ll"
-{}
+#line 606 "parameters_flexer.ll"
+{ return MP_nw_check_covvalue;}
 	YY_BREAK
 case 479:
 YY_RULE_SETUP
 #line 608 "parameters_flexer.ll"
-{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+{yy_pop_state(); return 0;}
 	YY_BREAK
 case 480:
 YY_RULE_SETUP
 #line 609 "parameters_flexer.ll"
-{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+{yy_pop_state(); return 1;}
 	YY_BREAK
 case 481:
 YY_RULE_SETUP
 #line 610 "parameters_flexer.ll"
-{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+{yy_pop_state(); return 2;}
 	YY_BREAK
 case 482:
-#line 614 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 611 "parameters_flexer.ll"
+{}
+	YY_BREAK
 case 483:
 YY_RULE_SETUP
-#line 614 "parameters_flexer.ll"
-{ return MP_paf_skip_whole_contig_scan;}
+#line 612 "parameters_flexer.ll"
+{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 484:
-#line 616 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 613 "parameters_flexer.ll"
+{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
+	YY_BREAK
 case 485:
 YY_RULE_SETUP
-#line 616 "parameters_flexer.ll"
-{ return MP_paf_use_quick_rule;}
+#line 614 "parameters_flexer.ll"
+{ BEGIN(0); return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 486:
 #line 618 "parameters_flexer.ll"
 case 487:
 YY_RULE_SETUP
 #line 618 "parameters_flexer.ll"
-{ return MP_paf_quickrule_minlen1;}
+{ return MP_paf_skip_whole_contig_scan;}
 	YY_BREAK
 case 488:
 #line 620 "parameters_flexer.ll"
 case 489:
 YY_RULE_SETUP
 #line 620 "parameters_flexer.ll"
-{ return MP_paf_quickrule_minsim1;}
+{ return MP_paf_use_quick_rule;}
 	YY_BREAK
 case 490:
 #line 622 "parameters_flexer.ll"
 case 491:
 YY_RULE_SETUP
 #line 622 "parameters_flexer.ll"
-{ return MP_paf_quickrule_minlen2;}
+{ return MP_paf_quickrule_minlen1;}
 	YY_BREAK
 case 492:
 #line 624 "parameters_flexer.ll"
 case 493:
 YY_RULE_SETUP
 #line 624 "parameters_flexer.ll"
-{ return MP_paf_quickrule_minsim2;}
+{ return MP_paf_quickrule_minsim1;}
 	YY_BREAK
 case 494:
 #line 626 "parameters_flexer.ll"
 case 495:
 YY_RULE_SETUP
 #line 626 "parameters_flexer.ll"
-{ return MP_paf_bbquickoverlap_minlen;}
+{ return MP_paf_quickrule_minlen2;}
 	YY_BREAK
 case 496:
 #line 628 "parameters_flexer.ll"
 case 497:
 YY_RULE_SETUP
 #line 628 "parameters_flexer.ll"
-{return MP_paf_max_startcache_filltime;}
+{ return MP_paf_quickrule_minsim2;}
 	YY_BREAK
 case 498:
-YY_RULE_SETUP
-#line 631 "parameters_flexer.ll"
-{ return MP_jobdef_draft;}
-	YY_BREAK
+#line 630 "parameters_flexer.ll"
 case 499:
 YY_RULE_SETUP
-#line 632 "parameters_flexer.ll"
-{ return MP_jobdef_normal   ;}
+#line 630 "parameters_flexer.ll"
+{ return MP_paf_bbquickoverlap_minlen;}
 	YY_BREAK
 case 500:
-YY_RULE_SETUP
-#line 633 "parameters_flexer.ll"
-{ return MP_jobdef_accurate ;}
-	YY_BREAK
+#line 632 "parameters_flexer.ll"
 case 501:
 YY_RULE_SETUP
-#line 634 "parameters_flexer.ll"
-{ return MP_jobdef_genome   ;}
+#line 632 "parameters_flexer.ll"
+{return MP_paf_max_startcache_filltime;}
 	YY_BREAK
 case 502:
 YY_RULE_SETUP
 #line 635 "parameters_flexer.ll"
-{ return MP_jobdef_est      ;}
+{ return MP_jobdef_draft;}
 	YY_BREAK
 case 503:
 YY_RULE_SETUP
 #line 636 "parameters_flexer.ll"
-{ return MP_jobdef_estsnppipeline1 ;}
+{ return MP_jobdef_normal   ;}
 	YY_BREAK
 case 504:
 YY_RULE_SETUP
 #line 637 "parameters_flexer.ll"
-{ return MP_jobdef_estsnppipeline2 ;}
+{ return MP_jobdef_accurate ;}
 	YY_BREAK
 case 505:
 YY_RULE_SETUP
 #line 638 "parameters_flexer.ll"
-{ return MP_jobdef_estsnppipeline3 ;}
+{ return MP_jobdef_genome   ;}
 	YY_BREAK
 case 506:
 YY_RULE_SETUP
 #line 639 "parameters_flexer.ll"
-{ return MP_jobdef_denovo   ;}
+{ return MP_jobdef_est      ;}
 	YY_BREAK
 case 507:
 YY_RULE_SETUP
 #line 640 "parameters_flexer.ll"
-{ return MP_jobdef_mapping  ;}
+{ return MP_jobdef_estsnppipeline1 ;}
 	YY_BREAK
 case 508:
 YY_RULE_SETUP
 #line 641 "parameters_flexer.ll"
-{ return MP_jobdef_sanger   ;}
+{ return MP_jobdef_estsnppipeline2 ;}
 	YY_BREAK
 case 509:
 YY_RULE_SETUP
 #line 642 "parameters_flexer.ll"
-{ return MP_jobdef_454	;}
+{ return MP_jobdef_estsnppipeline3 ;}
 	YY_BREAK
 case 510:
-#line 644 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 643 "parameters_flexer.ll"
+{ return MP_jobdef_denovo   ;}
+	YY_BREAK
 case 511:
 YY_RULE_SETUP
 #line 644 "parameters_flexer.ll"
-{ return MP_jobdef_iontor	;}
+{ return MP_jobdef_mapping  ;}
 	YY_BREAK
 case 512:
-#line 646 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 645 "parameters_flexer.ll"
+{ return MP_jobdef_sanger   ;}
+	YY_BREAK
 case 513:
-#line 647 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 646 "parameters_flexer.ll"
+{ return MP_jobdef_454	;}
+	YY_BREAK
 case 514:
 #line 648 "parameters_flexer.ll"
 case 515:
 YY_RULE_SETUP
 #line 648 "parameters_flexer.ll"
-{ return MP_jobdef_pacbiolq	;}
+{ return MP_jobdef_iontor	;}
 	YY_BREAK
 case 516:
 #line 650 "parameters_flexer.ll"
@@ -6819,452 +7674,463 @@ case 518:
 case 519:
 YY_RULE_SETUP
 #line 652 "parameters_flexer.ll"
-{ return MP_jobdef_pacbiohq	;}
+{ return MP_jobdef_pacbiolq	;}
 	YY_BREAK
 case 520:
-YY_RULE_SETUP
-#line 653 "parameters_flexer.ll"
-{ return MP_jobdef_text   ;}
-	YY_BREAK
-case 521:
-YY_RULE_SETUP
 #line 654 "parameters_flexer.ll"
-{ return MP_jobdef_solexa   ;}
-	YY_BREAK
-case 522:
-YY_RULE_SETUP
+case 521:
 #line 655 "parameters_flexer.ll"
-{ return MP_jobdef_solid	;}
-	YY_BREAK
+case 522:
+#line 656 "parameters_flexer.ll"
 case 523:
 YY_RULE_SETUP
 #line 656 "parameters_flexer.ll"
-
+{ return MP_jobdef_pacbiohq	;}
 	YY_BREAK
 case 524:
 YY_RULE_SETUP
 #line 657 "parameters_flexer.ll"
-{ return MP_UNRECOGNISED_STRING;}
+{ return MP_jobdef_text   ;}
 	YY_BREAK
 case 525:
-/* rule 525 can match eol */
 YY_RULE_SETUP
 #line 658 "parameters_flexer.ll"
-{ BEGIN(0); return MP_jobdefend;}
+{ return MP_jobdef_solexa   ;}
 	YY_BREAK
 case 526:
-#line 660 "parameters_flexer.ll"
-case YY_STATE_EOF(JOB_MODE):
-#line 660 "parameters_flexer.ll"
-{ BEGIN(0); return MP_jobdefend;}
+YY_RULE_SETUP
+#line 659 "parameters_flexer.ll"
+{ return MP_jobdef_solid	;}
 	YY_BREAK
 case 527:
 YY_RULE_SETUP
-#line 661 "parameters_flexer.ll"
-{ BEGIN(JOB_MODE); return MP_jobdefstart;}
+#line 660 "parameters_flexer.ll"
+
 	YY_BREAK
 case 528:
 YY_RULE_SETUP
-#line 664 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_all;}
+#line 661 "parameters_flexer.ll"
+{ return MP_UNRECOGNISED_STRING;}
 	YY_BREAK
 case 529:
+/* rule 529 can match eol */
 YY_RULE_SETUP
-#line 665 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_sanger;}
+#line 662 "parameters_flexer.ll"
+{ BEGIN(0); return MP_jobdefend;}
 	YY_BREAK
 case 530:
-YY_RULE_SETUP
-#line 666 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_454;}
+#line 664 "parameters_flexer.ll"
+case YY_STATE_EOF(JOB_MODE):
+#line 664 "parameters_flexer.ll"
+{ BEGIN(0); return MP_jobdefend;}
 	YY_BREAK
 case 531:
 YY_RULE_SETUP
-#line 667 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_iontor;}
+#line 665 "parameters_flexer.ll"
+{ BEGIN(JOB_MODE); return MP_jobdefstart;}
 	YY_BREAK
 case 532:
 YY_RULE_SETUP
 #line 668 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_pacbiohq;}
+{ return MP_quickmode_noclipping_all;}
 	YY_BREAK
 case 533:
 YY_RULE_SETUP
 #line 669 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_pacbiolq;}
+{ return MP_quickmode_noclipping_sanger;}
 	YY_BREAK
 case 534:
 YY_RULE_SETUP
 #line 670 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_text;}
+{ return MP_quickmode_noclipping_454;}
 	YY_BREAK
 case 535:
 YY_RULE_SETUP
 #line 671 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_solexa;}
+{ return MP_quickmode_noclipping_iontor;}
 	YY_BREAK
 case 536:
 YY_RULE_SETUP
 #line 672 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_solid;}
+{ return MP_quickmode_noclipping_pacbiohq;}
 	YY_BREAK
 case 537:
 YY_RULE_SETUP
 #line 673 "parameters_flexer.ll"
-{ BEGIN(0); }
+{ return MP_quickmode_noclipping_pacbiolq;}
 	YY_BREAK
 case 538:
-#line 677 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 674 "parameters_flexer.ll"
+{ return MP_quickmode_noclipping_text;}
+	YY_BREAK
 case 539:
 YY_RULE_SETUP
-#line 677 "parameters_flexer.ll"
-{BEGIN(GE_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 675 "parameters_flexer.ll"
+{ return MP_quickmode_noclipping_solexa;}
 	YY_BREAK
 case 540:
-#line 679 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 676 "parameters_flexer.ll"
+{ return MP_quickmode_noclipping_solid;}
+	YY_BREAK
 case 541:
 YY_RULE_SETUP
-#line 679 "parameters_flexer.ll"
-{BEGIN(LR_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 677 "parameters_flexer.ll"
+{ BEGIN(0); }
 	YY_BREAK
 case 542:
 #line 681 "parameters_flexer.ll"
 case 543:
 YY_RULE_SETUP
 #line 681 "parameters_flexer.ll"
-{BEGIN(SB_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(GE_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 544:
 #line 683 "parameters_flexer.ll"
 case 545:
 YY_RULE_SETUP
 #line 683 "parameters_flexer.ll"
-{BEGIN(CL_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(LR_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 546:
 #line 685 "parameters_flexer.ll"
 case 547:
-#line 686 "parameters_flexer.ll"
-case 548:
 YY_RULE_SETUP
-#line 686 "parameters_flexer.ll"
-{BEGIN(OUTPUT_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 685 "parameters_flexer.ll"
+{BEGIN(SB_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 548:
+#line 687 "parameters_flexer.ll"
 case 549:
-#line 688 "parameters_flexer.ll"
-case 550:
 YY_RULE_SETUP
-#line 688 "parameters_flexer.ll"
-{ BEGIN(FILE_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 687 "parameters_flexer.ll"
+{BEGIN(CL_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 550:
+#line 689 "parameters_flexer.ll"
 case 551:
 #line 690 "parameters_flexer.ll"
 case 552:
 YY_RULE_SETUP
 #line 690 "parameters_flexer.ll"
-{BEGIN(AS_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(OUTPUT_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 553:
 #line 692 "parameters_flexer.ll"
 case 554:
 YY_RULE_SETUP
 #line 692 "parameters_flexer.ll"
-{BEGIN(DP_MODE); return MP_PARSING_SECTIONCHANGE;}
+{ BEGIN(FILE_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 555:
 #line 694 "parameters_flexer.ll"
 case 556:
 YY_RULE_SETUP
 #line 694 "parameters_flexer.ll"
-{BEGIN(EDIT_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(AS_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 557:
 #line 696 "parameters_flexer.ll"
 case 558:
 YY_RULE_SETUP
 #line 696 "parameters_flexer.ll"
-{BEGIN(SKIM_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(DP_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 559:
 #line 698 "parameters_flexer.ll"
 case 560:
-#line 699 "parameters_flexer.ll"
-case 561:
 YY_RULE_SETUP
-#line 699 "parameters_flexer.ll"
-{BEGIN(HASHSTAT_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 698 "parameters_flexer.ll"
+{BEGIN(EDIT_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 561:
+#line 700 "parameters_flexer.ll"
 case 562:
-#line 701 "parameters_flexer.ll"
-case 563:
 YY_RULE_SETUP
-#line 701 "parameters_flexer.ll"
-{BEGIN(ALIGN_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 700 "parameters_flexer.ll"
+{BEGIN(SKIM_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 563:
+#line 702 "parameters_flexer.ll"
 case 564:
 #line 703 "parameters_flexer.ll"
 case 565:
 YY_RULE_SETUP
 #line 703 "parameters_flexer.ll"
-{BEGIN(CO_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(HASHSTAT_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 566:
 #line 705 "parameters_flexer.ll"
 case 567:
-#line 706 "parameters_flexer.ll"
-case 568:
 YY_RULE_SETUP
-#line 706 "parameters_flexer.ll"
-{BEGIN(DIR_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 705 "parameters_flexer.ll"
+{BEGIN(ALIGN_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 568:
+#line 707 "parameters_flexer.ll"
 case 569:
-#line 708 "parameters_flexer.ll"
-case 570:
 YY_RULE_SETUP
-#line 708 "parameters_flexer.ll"
-{BEGIN(MI_MODE); return MP_PARSING_SECTIONCHANGE;}
+#line 707 "parameters_flexer.ll"
+{BEGIN(CO_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
+case 570:
+#line 709 "parameters_flexer.ll"
 case 571:
 #line 710 "parameters_flexer.ll"
 case 572:
-#line 711 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 710 "parameters_flexer.ll"
+{BEGIN(DIR_MODE); return MP_PARSING_SECTIONCHANGE;}
+	YY_BREAK
 case 573:
 #line 712 "parameters_flexer.ll"
 case 574:
 YY_RULE_SETUP
 #line 712 "parameters_flexer.ll"
-{BEGIN(NW_MODE); return MP_PARSING_SECTIONCHANGE;}
+{BEGIN(MI_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 575:
 #line 714 "parameters_flexer.ll"
 case 576:
-YY_RULE_SETUP
-#line 714 "parameters_flexer.ll"
-{ BEGIN(PAF_MODE); return MP_PARSING_SECTIONCHANGE;}
-	YY_BREAK
+#line 715 "parameters_flexer.ll"
 case 577:
-YY_RULE_SETUP
 #line 716 "parameters_flexer.ll"
-{ return MP_params_for_common;}
-	YY_BREAK
 case 578:
 YY_RULE_SETUP
-#line 717 "parameters_flexer.ll"
-{ return MP_params_for_sanger;}
+#line 716 "parameters_flexer.ll"
+{BEGIN(NW_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 579:
-YY_RULE_SETUP
 #line 718 "parameters_flexer.ll"
-{ return MP_params_for_454;}
-	YY_BREAK
 case 580:
 YY_RULE_SETUP
-#line 719 "parameters_flexer.ll"
-{ return MP_params_for_iontor;}
+#line 718 "parameters_flexer.ll"
+{ BEGIN(PAF_MODE); return MP_PARSING_SECTIONCHANGE;}
 	YY_BREAK
 case 581:
 YY_RULE_SETUP
 #line 720 "parameters_flexer.ll"
-{ return MP_params_for_pacbiolq;}
+{ return MP_params_for_common;}
 	YY_BREAK
 case 582:
 YY_RULE_SETUP
 #line 721 "parameters_flexer.ll"
-{ return MP_params_for_pacbiohq;}
+{ return MP_params_for_sanger;}
 	YY_BREAK
 case 583:
 YY_RULE_SETUP
 #line 722 "parameters_flexer.ll"
-{ return MP_params_for_text;}
+{ return MP_params_for_454;}
 	YY_BREAK
 case 584:
 YY_RULE_SETUP
 #line 723 "parameters_flexer.ll"
-{ return MP_params_for_solexa;}
+{ return MP_params_for_iontor;}
 	YY_BREAK
 case 585:
 YY_RULE_SETUP
 #line 724 "parameters_flexer.ll"
-{ return MP_params_for_solid;}
+{ return MP_params_for_pacbiolq;}
 	YY_BREAK
 case 586:
 YY_RULE_SETUP
-#line 726 "parameters_flexer.ll"
-{ return MP_silentparams_for_common;}
+#line 725 "parameters_flexer.ll"
+{ return MP_params_for_pacbiohq;}
 	YY_BREAK
 case 587:
 YY_RULE_SETUP
-#line 727 "parameters_flexer.ll"
-{ return MP_silentparams_for_sanger;}
+#line 726 "parameters_flexer.ll"
+{ return MP_params_for_text;}
 	YY_BREAK
 case 588:
 YY_RULE_SETUP
-#line 728 "parameters_flexer.ll"
-{ return MP_silentparams_for_454;}
+#line 727 "parameters_flexer.ll"
+{ return MP_params_for_solexa;}
 	YY_BREAK
 case 589:
 YY_RULE_SETUP
-#line 729 "parameters_flexer.ll"
-{ return MP_silentparams_for_iontor;}
+#line 728 "parameters_flexer.ll"
+{ return MP_params_for_solid;}
 	YY_BREAK
 case 590:
 YY_RULE_SETUP
 #line 730 "parameters_flexer.ll"
-{ return MP_silentparams_for_pacbiolq;}
+{ return MP_silentparams_for_common;}
 	YY_BREAK
 case 591:
 YY_RULE_SETUP
 #line 731 "parameters_flexer.ll"
-{ return MP_silentparams_for_pacbiohq;}
+{ return MP_silentparams_for_sanger;}
 	YY_BREAK
 case 592:
 YY_RULE_SETUP
 #line 732 "parameters_flexer.ll"
-{ return MP_silentparams_for_text;}
+{ return MP_silentparams_for_454;}
 	YY_BREAK
 case 593:
 YY_RULE_SETUP
 #line 733 "parameters_flexer.ll"
-{ return MP_silentparams_for_solexa;}
+{ return MP_silentparams_for_iontor;}
 	YY_BREAK
 case 594:
 YY_RULE_SETUP
 #line 734 "parameters_flexer.ll"
-{ return MP_silentparams_for_solid;}
+{ return MP_silentparams_for_pacbiolq;}
 	YY_BREAK
 case 595:
 YY_RULE_SETUP
-#line 737 "parameters_flexer.ll"
-{ return MP_quickmode_borg;}
+#line 735 "parameters_flexer.ll"
+{ return MP_silentparams_for_pacbiohq;}
 	YY_BREAK
 case 596:
-#line 740 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 736 "parameters_flexer.ll"
+{ return MP_silentparams_for_text;}
+	YY_BREAK
 case 597:
-#line 741 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 737 "parameters_flexer.ll"
+{ return MP_silentparams_for_solexa;}
+	YY_BREAK
 case 598:
 YY_RULE_SETUP
-#line 741 "parameters_flexer.ll"
-{ filenameid=MP_quickmode_loadparam; yy_push_state(FN_MODE);}
+#line 738 "parameters_flexer.ll"
+{ return MP_silentparams_for_solid;}
 	YY_BREAK
 case 599:
 YY_RULE_SETUP
-#line 743 "parameters_flexer.ll"
-{ return MP_quickmode_hirep_something;}
+#line 741 "parameters_flexer.ll"
+{ return MP_quickmode_borg;}
 	YY_BREAK
 case 600:
-YY_RULE_SETUP
 #line 744 "parameters_flexer.ll"
-{ return MP_quickmode_hirep_good;}
-	YY_BREAK
 case 601:
-YY_RULE_SETUP
 #line 745 "parameters_flexer.ll"
-{ return MP_quickmode_hirep_best;}
-	YY_BREAK
 case 602:
 YY_RULE_SETUP
-#line 746 "parameters_flexer.ll"
-{ return MP_quickmode_highlyrepetitive;}
+#line 745 "parameters_flexer.ll"
+{ filenameid=MP_quickmode_loadparam; yy_push_state(FN_MODE);}
 	YY_BREAK
 case 603:
 YY_RULE_SETUP
 #line 747 "parameters_flexer.ll"
-{ return MP_quickmode_highqualitydata;}
+{ return MP_quickmode_hirep_something;}
 	YY_BREAK
 case 604:
 YY_RULE_SETUP
 #line 748 "parameters_flexer.ll"
-{ return MP_quickmode_lowqualitydata;}
+{ return MP_quickmode_hirep_good;}
 	YY_BREAK
 case 605:
 YY_RULE_SETUP
-#line 751 "parameters_flexer.ll"
-{ BEGIN(ASKFORTECH_NOCLIPPING);}
+#line 749 "parameters_flexer.ll"
+{ return MP_quickmode_hirep_best;}
 	YY_BREAK
 case 606:
 YY_RULE_SETUP
-#line 753 "parameters_flexer.ll"
-{ return MP_quickmode_noclipping_all;}
+#line 750 "parameters_flexer.ll"
+{ return MP_quickmode_highlyrepetitive;}
 	YY_BREAK
 case 607:
-#line 756 "parameters_flexer.ll"
+YY_RULE_SETUP
+#line 751 "parameters_flexer.ll"
+{ return MP_quickmode_highqualitydata;}
+	YY_BREAK
 case 608:
 YY_RULE_SETUP
-#line 756 "parameters_flexer.ll"
-{ return MP_quickmode_noquality_all;}
+#line 752 "parameters_flexer.ll"
+{ return MP_quickmode_lowqualitydata;}
 	YY_BREAK
 case 609:
 YY_RULE_SETUP
-#line 758 "parameters_flexer.ll"
+#line 755 "parameters_flexer.ll"
+{ BEGIN(ASKFORTECH_NOCLIPPING);}
+	YY_BREAK
+case 610:
+YY_RULE_SETUP
+#line 757 "parameters_flexer.ll"
+{ return MP_quickmode_noclipping_all;}
+	YY_BREAK
+case 611:
+#line 760 "parameters_flexer.ll"
+case 612:
+YY_RULE_SETUP
+#line 760 "parameters_flexer.ll"
+{ return MP_quickmode_noquality_all;}
+	YY_BREAK
+case 613:
+YY_RULE_SETUP
+#line 762 "parameters_flexer.ll"
 {BEGIN(0); return MP_PARSING_SECTIONRESET;} /*Hack for
 							     parsing command
 							     lines
                                    where each blank resets the state */
 	YY_BREAK
-case 610:
+case 614:
 YY_RULE_SETUP
-#line 762 "parameters_flexer.ll"
+#line 766 "parameters_flexer.ll"
 {return MP_ANID;}
 	YY_BREAK
-case 611:
+case 615:
 YY_RULE_SETUP
-#line 763 "parameters_flexer.ll"
+#line 767 "parameters_flexer.ll"
 {return MP_FLOAT;}
 	YY_BREAK
-case 612:
+case 616:
 YY_RULE_SETUP
-#line 764 "parameters_flexer.ll"
+#line 768 "parameters_flexer.ll"
 {return MP_INT;}
 	YY_BREAK
-case 613:
+case 617:
 YY_RULE_SETUP
-#line 766 "parameters_flexer.ll"
+#line 770 "parameters_flexer.ll"
 
 	YY_BREAK
-case 614:
+case 618:
 YY_RULE_SETUP
-#line 767 "parameters_flexer.ll"
+#line 771 "parameters_flexer.ll"
 
 	YY_BREAK
-case 615:
+case 619:
 YY_RULE_SETUP
-#line 768 "parameters_flexer.ll"
+#line 772 "parameters_flexer.ll"
 
 	YY_BREAK
-case 616:
+case 620:
 YY_RULE_SETUP
-#line 770 "parameters_flexer.ll"
+#line 774 "parameters_flexer.ll"
 {yy_push_state(COMMENT_MODE);} /* munch commentline, # is start of comment */
 	YY_BREAK
-case 617:
-/* rule 617 can match eol */
+case 621:
+/* rule 621 can match eol */
 YY_RULE_SETUP
-#line 771 "parameters_flexer.ll"
+#line 775 "parameters_flexer.ll"
 { yy_pop_state();}
 	YY_BREAK
-case 618:
-/* rule 618 can match eol */
+case 622:
+/* rule 622 can match eol */
 YY_RULE_SETUP
-#line 773 "parameters_flexer.ll"
+#line 777 "parameters_flexer.ll"
 {/* munch these, if not recognised earlier */ }
 	YY_BREAK
-case 619:
-/* rule 619 can match eol */
+case 623:
+/* rule 623 can match eol */
 YY_RULE_SETUP
-#line 775 "parameters_flexer.ll"
+#line 779 "parameters_flexer.ll"
 {return MP_ERROR_DASHES;}
 	YY_BREAK
-case 620:
+case 624:
 YY_RULE_SETUP
-#line 776 "parameters_flexer.ll"
+#line 780 "parameters_flexer.ll"
 {return MP_ERROR;}
 	YY_BREAK
-case 621:
+case 625:
 YY_RULE_SETUP
-#line 778 "parameters_flexer.ll"
+#line 782 "parameters_flexer.ll"
 ECHO;
 	YY_BREAK
-#line 7268 "parameters_flexer.cc"
+#line 8134 "parameters_flexer.cc"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(GET_UNTIL_NEWLINE):
 case YY_STATE_EOF(GE_MODE):
@@ -7674,7 +8540,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 6278 )
+			if ( yy_current_state >= 6326 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -7702,7 +8568,7 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 6278 )
+		if ( yy_current_state >= 6326 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -8193,7 +9059,7 @@ void MPfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 778 "parameters_flexer.ll"
+#line 782 "parameters_flexer.ll"
 
 
 
@@ -92,6 +92,8 @@ FILENAME [/A-Za-z0-9_#.][\-/A-Za-z0-9_#.]+
 <GE_MODE>"mps"                   {return MP_as_amm_maxprocesssize;}
 <GE_MODE>"automatic_memory_management" |
 <GE_MODE>"amm"                 { yy_push_state(ASK_YN_MODE); return MP_as_automemmanagement;}
+<GE_MODE>"pin_threads_to_cores" |
+<GE_MODE>"ptc"                 { yy_push_state(ASK_YN_MODE); return MP_as_pinthreads;}
 
 <GE_MODE>"clean_tmp_files" |
 <GE_MODE>"ctf"                 { yy_push_state(ASK_YN_MODE); return MP_as_cleanup_tmp_files;}
@@ -303,6 +305,8 @@ FILENAME [/A-Za-z0-9_#.][\-/A-Za-z0-9_#.]+
 <OUTPUT_MODE>"org"                 { yy_push_state(ASK_YN_MODE); return MP_as_output_gap4da;}
 <OUTPUT_MODE>"output_result_fasta" |
 <OUTPUT_MODE>"orf"                 { yy_push_state(ASK_YN_MODE); return MP_as_output_fasta;}
+<OUTPUT_MODE>"output_result_scaffolds" |
+<OUTPUT_MODE>"orsc"                { yy_push_state(ASK_YN_MODE); return MP_as_output_scaffolds;}
 
 <OUTPUT_MODE>"hcpl" |
 <OUTPUT_MODE>"html_chars_per_line" { return MP_con_output_html_cpl;}
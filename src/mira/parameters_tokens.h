@@ -34,6 +34,7 @@ enum { MP_ed_mira_automatic_contig_editing=1000,
        MP_sp_est_startstep=1100,
 
        MP_as_numthreads=1200,
+       MP_as_pinthreads,
        MP_as_automemmanagement,
        MP_as_amm_keeppercentfree,
        MP_as_amm_maxprocesssize,
@@ -88,6 +89,7 @@ enum { MP_ed_mira_automatic_contig_editing=1000,
        MP_as_output_tcs,
        MP_as_output_gap4da,
        MP_as_output_fasta,
+       MP_as_output_scaffolds,
        MP_as_output_removerollovertmps,
        MP_as_output_removetmpdir,
 